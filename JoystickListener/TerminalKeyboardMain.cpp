@@ -0,0 +1,152 @@
+// Headless Linux / SSH icin ayri program: CTerminalKeyboardListener modlari.
+// main.cpp Win32 (WinMM/DirectInput) icindir; bu dosya yalnizca POSIX'te derlenir:
+//   g++ -std=c++20 -O2 -Isrc -o terminal_keyboard TerminalKeyboardMain.cpp src/TerminalKeyboard.cpp
+//       src/Aircraft.cpp src/LoopPacer.cpp src/ListenerMetrics.cpp src/TraceRecorder.cpp -lpthread
+//   ./terminal_keyboard pty         # pseudo-terminal testi (varsayilan), basarisizsa cikis kodu 1
+//   ./terminal_keyboard aircraft    # raw tty klavye ile CAircraft
+#ifndef _WIN32
+
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "Aircraft.h"
+#include "InputEvent.h"
+#include "KeyNames.h"
+#include "LoopPacer.h"
+#include "TerminalKeyboard.h"
+
+// Headless Linux / SSH: oklar roll/pitch, A/D yaw; ESC ile cikis.
+// Terminal birakma bildirmedigi icin Up, releaseTimeout sonra gelir.
+int mainTerminalKeyboardWithAircraft()
+{
+    CAircraft aircraft;
+
+    CTerminalKeyboardListener keyboard;
+    keyboard.SetLogLevel(LogCategory::Key, LogLevel::Off);
+    keyboard.SetLogLevel(LogCategory::KeyHold, LogLevel::Off);
+
+    if (!keyboard.Init())
+    {
+        std::cerr << "Terminal init failed.\n";
+        return 1;
+    }
+
+    // Down'da komut, Up'ta sifir; komutlar sim thread'inde Update() ile uygulanir
+    auto bind = [&keyboard, &aircraft](int vk, AircraftCommand down, AircraftCommand up) {
+        keyboard.RegisterHandler(vk, [&aircraft, down, up](const KeyEvent& evt) {
+            if (evt.state == KeyState::Down)
+                aircraft.PostCommand(down);
+            else if (evt.state == KeyState::Up)
+                aircraft.PostCommand(up);
+            });
+        };
+
+    bind(KeyNames::VkFromName("ArrowLeft"),  AircraftCommand().SetRoll(-1.0),  AircraftCommand().SetRoll(0.0));
+    bind(KeyNames::VkFromName("ArrowRight"), AircraftCommand().SetRoll(1.0),   AircraftCommand().SetRoll(0.0));
+    bind(KeyNames::VkFromName("ArrowUp"),    AircraftCommand().SetPitch(1.0),  AircraftCommand().SetPitch(0.0));
+    bind(KeyNames::VkFromName("ArrowDown"),  AircraftCommand().SetPitch(-1.0), AircraftCommand().SetPitch(0.0));
+    bind(KeyNames::VkFromName("A"),          AircraftCommand().SetYaw(-1.0),   AircraftCommand().SetYaw(0.0));
+    bind(KeyNames::VkFromName("D"),          AircraftCommand().SetYaw(1.0),    AircraftCommand().SetYaw(0.0));
+
+    keyboard.Start();
+
+    CLoopPacer simPacer(std::chrono::milliseconds(10));
+
+    while (keyboard.IsRunning())
+    {
+        simPacer.Wait();
+        aircraft.Update();
+        aircraft.PrintStatus();
+    }
+
+    keyboard.Stop();
+    keyboard.GetMetricsSnapshot().Print(std::cout);
+
+    return 0;
+}
+
+// Pseudo-terminal uzerinden kod cozucu ve Down/Hold/Up uretimi kontrolu
+int mainTerminalKeyboardPtyTest()
+{
+    int master = posix_openpt(O_RDWR | O_NOCTTY);
+    if (master < 0 || grantpt(master) != 0 || unlockpt(master) != 0)
+    {
+        std::cerr << "posix_openpt failed.\n";
+        return 1;
+    }
+    int slave = open(ptsname(master), O_RDWR | O_NOCTTY);
+
+    TerminalKeyboardConfig config;
+    config.releaseTimeout = std::chrono::milliseconds(80);
+
+    CTerminalKeyboardListener keyboard;
+    keyboard.SetFd(slave);
+    keyboard.SetConfig(config);
+    keyboard.SetSilentMode(true);
+
+    std::mutex eventsMutex;
+    std::vector<InputEvent> events;
+    keyboard.SetBatchHandler([&](std::span<const InputEvent> batch) {
+        std::lock_guard<std::mutex> lock(eventsMutex);
+        events.insert(events.end(), batch.begin(), batch.end());
+        });
+
+    keyboard.Init();
+    keyboard.Start();
+
+    auto type = [master](const char* bytes, int pauseMs) {
+        (void)!write(master, bytes, strlen(bytes));
+        std::this_thread::sleep_for(std::chrono::milliseconds(pauseMs));
+        };
+
+    type("a", 20); type("a", 20); type("a", 150);           // Down, Hold, Hold, Up
+    type("\x1b[A", 20);                                     // ArrowUp
+    type("\x1b[1;5C", 20);                                  // Ctrl+ArrowRight
+    type("\x1b[15~", 20);                                   // F5
+    type("\x1bOP", 20);                                     // F1 (SS3)
+    type("\x1bx", 20);                                      // Alt+X
+    type("!", 150);                                         // Shift+1
+    type("\x1b", 200);                                      // tek ESC: zaman asimi sonra Escape, cikis
+
+    keyboard.Stop();
+    close(slave);
+    close(master);
+
+    const std::string expected =
+        "KeyDown 65,KeyHold 65,KeyHold 65,KeyUp 65,KeyDown 38,KeyUp 38,KeyDown 551,KeyUp 551,"
+        "KeyDown 116,KeyUp 116,KeyDown 112,KeyUp 112,KeyDown 1112,KeyUp 1112,KeyDown 305,KeyUp 305,"
+        "KeyDown 27,KeyUp 27,";
+
+    std::string actual;
+    for (const InputEvent& evt : events)
+        actual += std::string(InputEventKindName(evt.kind)) + " " + std::to_string(evt.code) + ",";
+
+    const bool pass = actual == expected;
+    std::cout << "[TerminalKeyboard] " << events.size() << " events, unknown sequences "
+              << keyboard.GetUnknownSequenceCount() << " : " << (pass ? "PASS" : "FAIL") << "\n";
+    if (!pass)
+        std::cout << "  expected " << expected << "\n  actual   " << actual << "\n";
+
+    return pass ? 0 : 1;
+}
+
+int main(int argc, char** argv)
+{
+    const std::string mode = argc > 1 ? argv[1] : "pty";
+
+    if (mode == "aircraft")
+        return mainTerminalKeyboardWithAircraft();
+    if (mode == "pty")
+        return mainTerminalKeyboardPtyTest();
+
+    std::cerr << "usage: " << argv[0] << " [pty|aircraft]\n";
+    return 2;
+}
+
+#endif
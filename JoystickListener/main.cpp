@@ -6,12 +6,30 @@
 #include <memory>
 #include <vector>
 #include <map>
+#include <cmath>
+#ifdef _WIN32
 #include <windows.h>
+#endif
 
 #include "FileLogger.h"
 #include "ConsoleLogger.h"
 #include "CompositeLogger.h"
+#include "MappedFileLogger.h"
 #include "Aircraft.h"
+#include "TraceRecorder.h"
+#include "LoopPacer.h"
+#include "ThreadConfig.h"
+#include "InputSession.h"
+#include "ReplayHarness.h"
+#include "SyntheticInputSource.h"
+#include "KeyboardListener.h"
+#include "KeyNames.h"
+#include "InputScheduler.h"
+#include "InputHub.h"
+#include "AllocationTracker.h"
+#include "FixedPointAxis.h"
+#include "FlightDataRecorder.h"
+#include "SessionAnalyzer.h"
 
 #include "JoystickListener.h"
 int mainJoystickListener()
@@ -29,7 +47,7 @@ int mainJoystickListener()
         return 1;
     }
 
-    joystick.SetAxisHandler([](double x, double y, double z, double pov, std::string povDir) {
+    joystick.SetAxisHandler([](double x, double y, double z, double pov, std::string_view povDir) {
         std::stringstream ss;
         ss << "[Axis] ";
         ss << "  X : " << std::setw(6) << x;
@@ -137,7 +155,7 @@ int mainJoystickListenerDI()
         std::cout << ss.str() << "\n";
         });
 
-    joystick.SetAxisHandler([](double x, double y, double z, double rz, double pov, std::string povDir) {
+    joystick.SetAxisHandler([](double x, double y, double z, double rz, double pov, std::string_view povDir) {
         std::stringstream ss;
         ss << "[Axis] ";
         ss << "  X : "      << std::setw(6) << x;
@@ -165,6 +183,64 @@ int mainJoystickListenerDI()
     return 0;
 }
 
+// Tum DIJOYSTATE2 eksenleri (konum, hiz, ivme, kuvvet) ve 4 POV; yalnizca degisen ve cihazda olanlar yazilir.
+int mainJoystickListenerDIAxisVector()
+{
+    auto guids = EnumerateJoysticks();
+
+    if (guids.empty())
+    {
+        std::cerr << "No DirectInput joystick found.\n";
+        return 1;
+    }
+
+    CJoystickListenerDI joystick(guids[0]);
+
+    if (!joystick.Init())
+    {
+        std::cerr << "Joystick init failed.\n";
+        return 1;
+    }
+
+    std::cout << "Axes :";
+    for (int i = 0; i < CJoystickListenerDI::VectorAxisCount; ++i)
+    {
+        if (joystick.GetBackend().GetAxisPresence() & (1u << i))
+            std::cout << " " << CJoystickListenerDI::GetAxisInfo(i).name;
+    }
+    std::cout << "\n";
+
+    joystick.SetAxisVectorHandler([](const AxisVector& vector) {
+        std::stringstream ss;
+        ss << "[AxisVector]";
+        for (int i = 0; i < vector.axisCount; ++i)
+        {
+            if (vector.HasChanged(i))
+                ss << "  " << vector.info[i].name << " : " << std::setw(6) << vector.Value(i);
+        }
+        for (int i = 0; i < vector.povCount; ++i)
+        {
+            if (vector.povChangedMask & (1u << i))
+                ss << "  Pov" << i << " : " << vector.pov[i];
+        }
+        std::cout << ss.str() << "\n";
+        });
+
+    joystick.StartListening();
+
+    std::cout << "Listening... Press ESC to exit.\n";
+
+    while (true)
+    {
+        if (GetAsyncKeyState(VK_ESCAPE) & 0x8000)
+            break;
+        Sleep(100);
+    }
+
+    joystick.StopListening();
+    return 0;
+}
+
 int mainJoystickListenerWithAircraft()
 {
     CAircraft aircraft;
@@ -196,7 +272,7 @@ int mainJoystickListenerWithAircraft()
         //std::cout << ss.str() << "\n";
         });
 
-    listener->SetAxisHandler([=](double x, double y, double z, double pov, std::string povDir) {
+    listener->SetAxisHandler([=](double x, double y, double z, double pov, std::string_view povDir) {
         std::stringstream ss;
         ss << "[Axis] ";
         ss << "  X : " << std::setw(6) << x;
@@ -209,31 +285,70 @@ int mainJoystickListenerWithAircraft()
         CAircraft* pAircraft = (CAircraft*)listener->GetExternalObject();
         if (pAircraft)
         {
-            bool isNormalized = listener->GetNormalize();
-            double normalizerCoeff = 1;// 1 / 65535.0;
-            pAircraft->SetRollCmd(x * normalizerCoeff);
-            pAircraft->SetPitchCmd(y * normalizerCoeff);
-            pAircraft->SetThrottleCmd(z * normalizerCoeff);
-            pAircraft->SetYawCmd(0);
+            // Listener thread'inden dogrudan Set*Cmd cagirmak yerine tek seferde yayinla;
+            // Update() sim thread'inde bir sonraki tick'te uygular.
+            pAircraft->PostCommand(AircraftCommand::FromAxes(x, y, z, 0));
         }
 
         });
 
     listener->CalibrateCenter();
 
+    // Ham ornek kaydi: true yapilirsa cikista session.jlss yazilir (mainReplayHarness ile oynatilir).
+    const bool recordSession = false;
+    CInputSessionRecorder recorder(InputDeviceKind::WinMM);
+    if (recordSession)
+        listener->SetRawSampleHandler([&recorder](const InputSample& sample) { recorder.Record(sample); });
+
+    // Gurultulu potansiyometreler icin One Euro filtresi; esigin altindaki titremeler olay uretmez,
+    // tek ornekli sicramalar reddedilir. Kayit ham ornekleri tutar.
+    AxisFilterConfig axisFilter;
+    axisFilter.enabled = true;
+    axisFilter.spikeThreshold = 0.5;
+    listener->SetAxisFilter(axisFilter);
+
+    // Chrome trace: true yapilirsa cikista trace.json yazilir (Perfetto ile acilir).
+    const bool enableTrace = false;
+    CTraceRecorder::Instance().SetEnabled(enableTrace);
+    JL_TRACE_THREAD("Sim");
+    JL_ALLOC_THREAD("Sim");
+
+    // Yuklu sim host'larinda listener'a RT oncelik ver; listenerCpu >= 0 ise o cekirdege sabitlenir.
+    // Yetki yoksa ayarlar atlanir ve GetThreadConfigResult() uyarilari listeler.
+    const int listenerCpu = -1;
+    ThreadConfig listenerThread;
+    listenerThread.name = "JoyListener";
+    if (listenerCpu >= 0)
+        listenerThread.cpuAffinity.push_back(listenerCpu);
+    listenerThread.policy = ThreadSchedPolicy::Fifo;
+    listenerThread.priority = 80;
+    listener->SetThreadConfig(listenerThread);
+
+    ThreadConfig simThread;
+    simThread.name = "Sim";
+    simThread.policy = ThreadSchedPolicy::RoundRobin;
+    simThread.priority = 40;
+
     listener->Start();
 
+    std::cout << "[Listener thread] " << listener->GetThreadConfigResult().ToString() << "\n";
+    std::cout << "[Sim thread] " << ApplyThreadConfigToCurrentThread(simThread).ToString() << "\n";
+
+    CLoopPacer simPacer(std::chrono::milliseconds(1), std::chrono::microseconds(50));
+
     auto lastPrint = std::chrono::steady_clock::now();
 
     while (listener->IsRunning())
     {
-        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        simPacer.Wait();
 
         if (GetAsyncKeyState(VK_ESCAPE) & 0x8000)
         {
             break;
         }
 
+        JL_TRACE_SCOPE("SimTick");
+
         aircraft.Update();
 
         auto now = std::chrono::steady_clock::now();
@@ -246,6 +361,16 @@ int mainJoystickListenerWithAircraft()
 
     listener->Stop();
 
+    listener->GetMetricsSnapshot().Print(std::cout);
+    listener->GetPacerStats().Print(std::cout, "listener");
+    listener->GetAxisFilterStats().Print(std::cout, "listener");
+    simPacer.GetStats().Print(std::cout, "sim");
+
+    if (enableTrace)
+        CTraceRecorder::Instance().WriteChromeJson("trace.json");
+
+    if (recordSession)
+        recorder.Save("session.jlss");
 
     return 0;
 }
@@ -289,7 +414,7 @@ int mainJoystickListenerDIWithAircraft()
         //std::cout << ss.str() << "\n";
         });
 
-    listener->SetAxisHandler([=](double x, double y, double z, double rz, double pov, std::string povDir) {
+    listener->SetAxisHandler([=](double x, double y, double z, double rz, double pov, std::string_view povDir) {
         std::stringstream ss;
         ss << "[Axis] ";
         ss << "  X : " << std::setw(6) << x;
@@ -303,31 +428,75 @@ int mainJoystickListenerDIWithAircraft()
         CAircraft* pAircraft = (CAircraft*)listener->GetExternalObject();
         if (pAircraft)
         {
-            bool isNormalized = listener->GetNormalize();
-            double normalizerCoeff = 1;// 1 / 65535.0;
-            pAircraft->SetRollCmd(x * normalizerCoeff);
-            pAircraft->SetPitchCmd(y * normalizerCoeff);
-            pAircraft->SetThrottleCmd(z * normalizerCoeff);
-            pAircraft->SetYawCmd(rz * normalizerCoeff);
+            pAircraft->PostCommand(AircraftCommand::FromAxes(x, y, z, rz));
         }
         });
 
     listener->CalibrateCenter();
 
+    // Ham ornek kaydi: true yapilirsa cikista session.jlss yazilir (mainReplayHarness ile oynatilir).
+    const bool recordSession = false;
+    CInputSessionRecorder recorder(InputDeviceKind::DirectInput);
+    if (recordSession)
+        listener->SetRawSampleHandler([&recorder](const InputSample& sample) { recorder.Record(sample); });
+
+    // Ucus verisi kaydi: true yapilirsa flight.jlfd yazilir (50 Hz, sutunlu ve sikistirilmis).
+    const bool recordFlight = false;
+    CFlightDataRecorder flightRecorder;
+    if (recordFlight)
+        flightRecorder.Start();
+
+    // Gurultulu potansiyometreler icin One Euro filtresi; esigin altindaki titremeler olay uretmez,
+    // tek ornekli sicramalar reddedilir. Kayit ham ornekleri tutar.
+    AxisFilterConfig axisFilter;
+    axisFilter.enabled = true;
+    axisFilter.spikeThreshold = 0.5;
+    listener->SetAxisFilter(axisFilter);
+
+    // Chrome trace: true yapilirsa cikista trace.json yazilir (Perfetto ile acilir).
+    const bool enableTrace = false;
+    CTraceRecorder::Instance().SetEnabled(enableTrace);
+    JL_TRACE_THREAD("Sim");
+    JL_ALLOC_THREAD("Sim");
+
+    // Yuklu sim host'larinda listener'a RT oncelik ver; listenerCpu >= 0 ise o cekirdege sabitlenir.
+    // Yetki yoksa ayarlar atlanir ve GetThreadConfigResult() uyarilari listeler.
+    const int listenerCpu = -1;
+    ThreadConfig listenerThread;
+    listenerThread.name = "JoyListener";
+    if (listenerCpu >= 0)
+        listenerThread.cpuAffinity.push_back(listenerCpu);
+    listenerThread.policy = ThreadSchedPolicy::Fifo;
+    listenerThread.priority = 80;
+    listener->SetThreadConfig(listenerThread);
+
+    ThreadConfig simThread;
+    simThread.name = "Sim";
+    simThread.policy = ThreadSchedPolicy::RoundRobin;
+    simThread.priority = 40;
+
     listener->Start();
 
+    std::cout << "[Listener thread] " << listener->GetThreadConfigResult().ToString() << "\n";
+    std::cout << "[Sim thread] " << ApplyThreadConfigToCurrentThread(simThread).ToString() << "\n";
+
+    CLoopPacer simPacer(std::chrono::milliseconds(1), std::chrono::microseconds(50));
+
     auto lastPrint = std::chrono::steady_clock::now();
 
     while (listener->IsRunning())
     {
-        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        simPacer.Wait();
 
         if (GetAsyncKeyState(VK_ESCAPE) & 0x8000)
         {
             break;
         }
 
+        JL_TRACE_SCOPE("SimTick");
+
         aircraft.Update();
+        flightRecorder.Sample(aircraft, CLoopPacer::NowNs());
 
         auto now = std::chrono::steady_clock::now();
         if (std::chrono::duration_cast<std::chrono::milliseconds>(now - lastPrint).count() > 20) {
@@ -338,7 +507,678 @@ int mainJoystickListenerDIWithAircraft()
     }
 
     listener->Stop();
+    flightRecorder.Stop();
+
+    listener->GetMetricsSnapshot().Print(std::cout);
+    listener->GetPacerStats().Print(std::cout, "listener");
+    listener->GetAxisFilterStats().Print(std::cout, "listener");
+    simPacer.GetStats().Print(std::cout, "sim");
+    if (recordFlight)
+        flightRecorder.GetStats().Print(std::cout);
 
+    if (enableTrace)
+        CTraceRecorder::Instance().WriteChromeJson("trace.json");
+
+    if (recordSession)
+        recorder.Save("session.jlss");
+
+    return 0;
+}
+
+// MappedFileLogger segmentlerindeki tamamlanmis kayitlari yazdirir (cokme sonrasi kurtarma dahil).
+// Eksen olaylari std::function yerine dogrudan sink'e; poll'dan PostCommand'a kadar yol inline edilir.
+struct AircraftAxisSink
+{
+    static constexpr bool WantsButtons = false;
+    static constexpr bool WantsButtonHeld = false;
+    static constexpr bool WantsAxes = true;
+
+    CAircraft* aircraft = nullptr;
+
+    void OnAxes(const double (&axes)[4], double pov, std::string_view povDir)
+    {
+        aircraft->PostCommand(AircraftCommand::FromAxes(axes[JoystickState::AxisX], axes[JoystickState::AxisY],
+            axes[JoystickState::AxisZ], axes[JoystickState::AxisRZ]));
+    }
+};
+
+using CJoystickListenerDIAircraft =
+    CJoystickListenerCore<CDirectInputJoystickBackend, DIAxisLayout<true>, AxisNormalizer<true>, CSinkDispatch<AircraftAxisSink>>;
+
+int mainJoystickListenerDIWithAircraftSink()
+{
+    CAircraft aircraft;
+
+    auto guids = EnumerateJoysticks();
+
+    if (guids.empty())
+    {
+        std::cerr << "No DirectInput joystick found.\n";
+        return 1;
+    }
+
+    AircraftAxisSink sink;
+    sink.aircraft = &aircraft;
+
+    CJoystickListenerDIAircraft listener(0, guids[0]);
+    listener.SetNormalize(true);
+    listener.SetSink(&sink);
+
+    if (!listener.Init())
+    {
+        std::cerr << "Joystick init failed.\n";
+        return 1;
+    }
+
+    listener.Start();
+
+    CLoopPacer simPacer(std::chrono::milliseconds(1), std::chrono::microseconds(50));
+
+    while (listener.IsRunning())
+    {
+        simPacer.Wait();
+
+        if (GetAsyncKeyState(VK_ESCAPE) & 0x8000)
+        {
+            break;
+        }
+
+        aircraft.Update();
+
+        aircraft.PrintStatus();
+    }
+
+    listener.Stop();
+    listener.GetMetricsSnapshot().Print(std::cout);
+
+    return 0;
+}
+
+int mainDumpLog(const std::string& basePath = "stress_keys")
+{
+    std::vector<MappedLogRecord> records;
+    MappedLogRecovery recovery = MappedLogReader::ReadAll(basePath, records);
+
+    for (const MappedLogRecord& record : records)
+        std::cout << record.segmentIndex << " " << record.timestampNs << " " << record.message << "\n";
+
+    std::cout << "[Log] segments : " << recovery.segments
+              << "  records : " << recovery.records
+              << "  torn : " << recovery.tornRecords << "\n";
+    return recovery.segments ? 0 : 1;
+}
+
+// Kayitli oturum uzerinde tahmin modellerinin hatasini olcer; PredictionConfig ayari icin.
+int mainPredictionTuning(const std::string& sessionPath = "session.jlss")
+{
+    CInputSession session;
+    if (!session.Load(sessionPath))
+    {
+        std::cerr << "Session load failed : " << sessionPath << "\n";
+        return 1;
+    }
+
+    const PredictionModel models[] = { PredictionModel::Hold, PredictionModel::Linear, PredictionModel::Quadratic };
+    const int64_t latencies[] = { 0, 2000000, 8000000 };
+
+    for (int64_t latencyNs : latencies)
+    {
+        for (PredictionModel model : models)
+        {
+            PredictionConfig config;
+            config.model = model;
+
+            PredictionEvalOptions options;
+            options.latencyNs = latencyNs;
+
+            CReplayHarness::EvaluatePrediction(session, config, options).Print(std::cout, sessionPath);
+        }
+    }
+    return 0;
+}
+
+// Kayitli oturumlari (<dir>/*.jlss) sanal saatle oynatir ve yorungeyi golden CSV ile karsilastirir.
+// updateGolden true ise golden dosyalar yeniden yazilir.
+int mainReplayHarness(const std::string& corpusDir = "replay", bool updateGolden = false)
+{
+    ReplayOptions options;
+    options.updateGolden = updateGolden;
+
+    CReplayHarness harness(options);
+    std::vector<ReplayResult> results = harness.RunCorpus(corpusDir);
+    CReplayHarness::PrintSummary(std::cout, results);
+
+    if (results.empty())
+    {
+        std::cerr << "No session found in " << corpusDir << "\n";
+        return 1;
+    }
+
+    for (const ReplayResult& r : results)
+    {
+        if (!r.passed)
+            return 1;
+    }
+    return 0;
+}
+
+// Sentetik yuksek hizli girdiyle listener hattini zorlar; kuyruk, dusen olay ve gecikme raporlanir.
+int mainSyntheticStress(double sampleRateHz = 20000.0, int durationS = 10)
+{
+    SyntheticInputConfig config;
+    config.sampleRateHz = sampleRateHz;
+    config.axes[0].waveform = AxisWaveform::Sine;
+    config.axes[0].frequencyHz = 2.0;
+    config.axes[1].waveform = AxisWaveform::Chirp;
+    config.axes[1].frequencyHz = 0.5;
+    config.axes[1].chirpEndHz = 200.0;
+    config.axes[5].waveform = AxisWaveform::Step;
+    config.axes[5].frequencyHz = 10.0;
+    config.axes[6].waveform = AxisWaveform::Noise;
+    config.axes[6].amplitude = 0.1;
+    config.buttonStormRateHz = 5000.0;
+    config.keyFloodRateHz = 2000.0;
+
+    CSyntheticInputSource source(config);
+
+    CJoystickListenerDI joystick(GUID{});
+    joystick.SetNormalize(true);
+    joystick.SetInputSource(&source);
+    joystick.SetPollPeriod(std::chrono::milliseconds(1));
+
+    // Joystick ve klavye olaylari hub'da zaman damgasina gore tek akisa birlesir
+    CInputHub hub;
+    uint64_t eventCounts[8] = {};
+    uint64_t orderViolations = 0;
+    int64_t lastTimestampNs = 0;
+    hub.SetHandler([&](std::span<const InputEvent> events) {
+        for (const InputEvent& evt : events)
+        {
+            eventCounts[static_cast<int>(evt.kind)]++;
+            if (evt.timestampNs < lastTimestampNs)
+                orderViolations++;
+            lastTimestampNs = evt.timestampNs;
+        }
+        });
+    joystick.SetBatchHandler(hub.MakeProducer());
+
+    // Tus loglari konsol yerine donen mmap segmentlerine (stress_keys.NNNNNN.jlog); mainDumpLog ile okunur
+    MappedLogConfig keyLogConfig;
+    keyLogConfig.basePath = "stress_keys";
+    auto keyLog = std::make_shared<MappedFileLogger>(keyLogConfig);
+
+    CKeyboardListener keyboard;
+    keyboard.SetLogger(keyLog);
+    keyboard.SetSilentMode(false);
+    keyboard.SetLogLevel(LogCategory::KeyHold, LogLevel::Off);     // her taramada basili tus satiri yazilmasin
+    keyboard.SetInputSource(&source);
+    keyboard.SetPollPeriod(std::chrono::milliseconds(1));
+    keyboard.SetBatchHandler(hub.MakeProducer());
+    keyboard.Init();
+
+    hub.Start();
+    source.Start();
+    joystick.Start();
+    keyboard.Start();
+
+    for (int i = 0; i < durationS; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::seconds(1));
+        source.GetStats().Print(std::cout);
+    }
+
+    source.Stop();
+    joystick.Stop();
+    keyboard.Stop();
+    hub.Stop();
+
+    source.GetStats().Print(std::cout);
+    joystick.GetMetricsSnapshot().Print(std::cout);
+    keyboard.GetMetricsSnapshot().Print(std::cout);
+    hub.GetStats().Print(std::cout);
+
+    std::cout << "[Events]";
+    for (int k = 0; k <= static_cast<int>(InputEventKind::KeyUp); ++k)
+        std::cout << "  " << InputEventKindName(static_cast<InputEventKind>(k)) << " : " << eventCounts[k];
+    std::cout << "  order violations : " << orderViolations << "\n";
+
+    return source.GetStats().KeptUp() ? 0 : 1;
+}
+
+// Hub uretici sayisiyla olcekleme: her uretici 16'lik batch'ler gonderir (poll basina bir batch gibi)
+int mainInputHubScaling(int maxProducers = 8, int eventsPerProducer = 1000000)
+{
+    const int batchSize = 16;
+
+    for (int producers = 1; producers <= maxProducers; producers *= 2)
+    {
+        CInputHub hub;
+        uint64_t orderViolations = 0;
+        int64_t lastTimestampNs = 0;
+        hub.SetHandler([&](std::span<const InputEvent> events) {
+            for (const InputEvent& evt : events)
+            {
+                if (evt.timestampNs < lastTimestampNs)
+                    orderViolations++;
+                lastTimestampNs = evt.timestampNs;
+            }
+            });
+        hub.Start();
+
+        const int64_t beginNs = CLoopPacer::NowNs();
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; ++p)
+        {
+            threads.emplace_back([&hub, p, eventsPerProducer]() {
+                InputEvent batch[batchSize];
+                for (int i = 0; i < eventsPerProducer / batchSize; ++i)
+                {
+                    const int64_t timestampNs = CLoopPacer::NowNs();
+                    for (int k = 0; k < batchSize; ++k)
+                        batch[k] = InputEvent::Make(timestampNs, static_cast<uint8_t>(p), InputEventKind::Axis, static_cast<uint16_t>(k), 0.0f);
+                    while (!hub.Post(batch))
+                        std::this_thread::yield();
+                }
+                });
+        }
+        for (std::thread& t : threads)
+            t.join();
+        const double elapsedS = (CLoopPacer::NowNs() - beginNs) / 1e9;
+
+        hub.Stop();
+
+        const InputHubStats stats = hub.GetStats();
+        std::cout << "[Producers " << producers << "] " << std::fixed << std::setprecision(1)
+                  << stats.posted / elapsedS / 1e6 << " M events/s  order violations : " << orderViolations << "\n";
+        stats.Print(std::cout);
+    }
+
+    return 0;
+}
+
+// Eksen normalize hatti: double (AxisNormalizer) ile Q15 tamsayi yol (skaler ve SSE2).
+// Ornek basina 4 eksen (DI duzeni); en iyi turun ns/ornek degeri ve double yola gore en buyuk sapma.
+int mainAxisPipelineBenchmark(int sampleCount = 1 << 20, int rounds = 20)
+{
+    const int axisCount = 4;
+    const int throttleAxis = JoystickState::AxisZ;
+
+    std::vector<int32_t> raw(static_cast<size_t>(sampleCount) * axisCount);
+    uint32_t seed = 12345;
+    for (int32_t& value : raw)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        value = static_cast<int32_t>(seed >> 16);
+    }
+
+    CFixedAxisNormalizer fixedNormalizer;
+    fixedNormalizer.Configure(axisCount, throttleAxis, true, FixedAxisConfig());
+
+    std::vector<double> axesDouble(raw.size());
+    std::vector<int16_t> axesScalar(raw.size());
+    std::vector<int16_t> axesQ15(raw.size());
+
+    auto run = [&](const char* name, auto&& body) {
+        int64_t bestNs = INT64_MAX;
+        for (int r = 0; r < rounds; ++r)
+        {
+            const int64_t beginNs = CLoopPacer::NowNs();
+            body();
+            bestNs = std::min(bestNs, CLoopPacer::NowNs() - beginNs);
+        }
+        std::cout << "[" << std::setw(12) << name << "] " << std::fixed << std::setprecision(2)
+                  << static_cast<double>(bestNs) / sampleCount << " ns/sample\n";
+        };
+
+    run("Double", [&]() {
+        for (int s = 0; s < sampleCount; ++s)
+        {
+            const int32_t* in = &raw[static_cast<size_t>(s) * axisCount];
+            double* out = &axesDouble[static_cast<size_t>(s) * axisCount];
+            for (int i = 0; i < axisCount; ++i)
+                out[i] = (i == throttleAxis) ? AxisNormalizer<true>::Throttle(in[i]) : AxisNormalizer<true>::Bipolar(in[i]);
+        }
+        });
+
+    run("Q15 scalar", [&]() {
+        for (int s = 0; s < sampleCount; ++s)
+            fixedNormalizer.NormalizeScalar(&raw[static_cast<size_t>(s) * axisCount], &axesScalar[static_cast<size_t>(s) * axisCount]);
+        });
+
+    run(CFixedAxisNormalizer::HasSimd() ? "Q15 SSE2" : "Q15", [&]() {
+        fixedNormalizer.NormalizeBatch(raw.data(), axesQ15.data(), sampleCount);
+        });
+
+    size_t mismatches = 0;
+    double maxError = 0.0;
+    for (size_t i = 0; i < raw.size(); ++i)
+    {
+        if (axesScalar[i] != axesQ15[i])
+            mismatches++;
+        maxError = std::max(maxError, std::abs(CFixedAxisNormalizer::ToDouble(axesQ15[i]) - axesDouble[i]));
+    }
+
+    std::cout << "Scalar/vector mismatches : " << mismatches << "\n";
+    std::cout << "Max error vs double      : " << std::scientific << maxError << " (1 LSB = " << 1.0 / 32767.0 << ")\n";
+
+    // DI eksen vektoru: bosta ham 0 okunan hiz ekseni (VX) 0.0, konum ekseni (X) -1.0 olmali
+    CAxisVectorProcessor vectorProcessor;
+    vectorProcessor.Configure(DIAxisLayout<>::VectorAxes, DIAxisLayout<>::VectorAxisCount, DIAxisLayout<>::PovCount, true, FixedAxisConfig());
+    AxisVector vector;
+    vectorProcessor.Process(vector);
+    const bool signedAxesOk = vector.Value(8) == 0.0 && vector.Value(0) == -1.0;
+    std::cout << "Raw 0 on VX / X          : " << std::fixed << vector.Value(8) << " / " << vector.Value(0) << (signedAxesOk ? "  OK\n" : "  FAIL\n");
+
+    return (mismatches == 0 && signedAxesOk) ? 0 : 1;
+}
+
+// Sanal saatle uzun bir ucus (varsayilan 2 saat, 50 Hz) kaydeder, sonra dosyayi tarar.
+// Sikistirma orani, tum sutunlarin tarama suresi ve kuantalama sonrasi en yuksek irtifa raporlanir.
+int mainFlightDataRecorder(const std::string& path = "flight.jlfd", double hours = 2.0)
+{
+    FlightRecorderConfig config;
+    config.path = path;
+    config.queueBlocks = 32;
+
+    CFlightDataRecorder recorder(config);
+    if (!recorder.Start())
+    {
+        std::cerr << "Cannot open " << path << "\n";
+        return 1;
+    }
+
+    // CAircraft kendi dinamigini yurutmez; yavas degisen tutum ve basit kinematik
+    CAircraft aircraft;
+    aircraft.SetLatitude(39.9);
+    aircraft.SetLongitude(32.85);
+    aircraft.SetAltitude(1000.0);
+    aircraft.SetSpeed(120.0);
+
+    const double degToRad = 3.14159265358979 / 180.0;
+    const double dt = 1.0 / config.sampleRateHz;
+    const int64_t periodNs = static_cast<int64_t>(1e9 / config.sampleRateHz);
+    const int64_t frameCount = static_cast<int64_t>(hours * 3600.0 * config.sampleRateHz);
+    const int64_t beginNs = CLoopPacer::NowNs();
+    uint32_t seed = 12345;
+    uint64_t stalls = 0;
+    double maxAltitude = -1e300;
+
+    for (int64_t i = 0; i < frameCount; ++i)
+    {
+        const double t = i * dt;
+        const double roll = 30.0 * std::sin(t * 0.05);
+        const double pitch = 5.0 * std::sin(t * 0.013);
+        aircraft.SetRoll(roll);
+        aircraft.SetPitch(pitch);
+        aircraft.SetYaw(2.0 * std::sin(t * 0.2));
+        aircraft.SetThrottle(0.7);
+        aircraft.SetThrottleCmd((i / 30000) % 2 ? 80 : 70);
+
+        const double heading = std::fmod(aircraft.GetHeading() + roll * 0.01 * dt + 360.0, 360.0);
+        const double speed = aircraft.GetSpeed();
+        aircraft.SetHeading(heading);
+        aircraft.SetLatitude(aircraft.GetLatitude() + speed * dt * std::cos(heading * degToRad) / 111320.0);
+        aircraft.SetLongitude(aircraft.GetLongitude() + speed * dt * std::sin(heading * degToRad) / 85000.0);
+        aircraft.SetAltitude(aircraft.GetAltitude() + speed * dt * std::sin(pitch * degToRad));
+        maxAltitude = std::max(maxAltitude, aircraft.GetAltitude());
+
+        // Periyot + birkac mikrosaniye sim tick titremesi
+        seed = seed * 1664525u + 1013904223u;
+        const int64_t timestampNs = beginNs + i * periodNs + static_cast<int64_t>(seed >> 20);
+
+        // Sanal saat yaziciyi gecer; dusurmek yerine blok bosalmasini bekle
+        const FlightDataFrame frame = FlightDataFrame::Capture(aircraft, timestampNs);
+        while (!recorder.Record(frame))
+        {
+            stalls++;
+            std::this_thread::yield();
+        }
+    }
+
+    recorder.Stop();
+    FlightRecorderStats stats = recorder.GetStats();
+    stats.droppedFrames -= stalls;
+    stats.Print(std::cout);
+
+    CFlightDataReader reader;
+    if (!reader.Open(path))
+    {
+        std::cerr << "Cannot read " << path << "\n";
+        return 1;
+    }
+
+    const int64_t scanBeginNs = CLoopPacer::NowNs();
+    double scannedMaxAltitude = -1e300;
+    const uint64_t scanned = reader.Scan(INT64_MIN, INT64_MAX, CFlightDataReader::AllColumns, [&](const FlightBlockData& data) {
+        for (size_t i = 0; i < data.count; ++i)
+            scannedMaxAltitude = std::max(scannedMaxAltitude, data.columns[FlightAltitude][i]);
+        });
+    const double scanMs = (CLoopPacer::NowNs() - scanBeginNs) / 1e6;
+
+    std::cout << "[FlightReader] blocks : " << reader.GetBlocks().size() << (reader.HasIndex() ? " (index)" : " (scanned headers)")
+              << "  frames : " << scanned << "  full scan : " << std::fixed << std::setprecision(1) << scanMs << " ms\n";
+    std::cout << "[FlightReader] max altitude : " << std::setprecision(3) << scannedMaxAltitude
+              << " (recorded " << maxAltitude << ")\n";
+
+    return scanned == static_cast<uint64_t>(frameCount) ? 0 : 1;
+}
+
+// Dizindeki tum .jlss/.jlfd kayitlarinin toplu istatistikleri. Once tek thread, sonra
+// threadCount (0: tum cekirdekler) ile calisir; birlestirilmis sonuc ayni olmali.
+int mainSessionAnalyzer(const std::string& directory = "recordings", int threadCount = 0)
+{
+    const std::vector<std::string> paths = CSessionAnalyzer::FindRecordings(directory);
+    if (paths.empty())
+    {
+        std::cerr << "No recording found in " << directory << "\n";
+        return 1;
+    }
+
+    SessionAnalyzerConfig config;
+    config.threadCount = 1;
+    const SessionAnalysis single = CSessionAnalyzer(config).Analyze(paths);
+
+    config.threadCount = threadCount;
+    const SessionAnalysis parallel = CSessionAnalyzer(config).Analyze(paths);
+    parallel.Print(std::cout);
+
+    const bool same = single.samples == parallel.samples && single.buttonEdges == parallel.buttonEdges &&
+        single.holdNs.Count() == parallel.holdNs.Count() && single.flightFrames == parallel.flightFrames &&
+        single.holdNs.Quantile(0.99) == parallel.holdNs.Quantile(0.99);
+    std::cout << "[SessionAnalyzer] 1 thread : " << std::setprecision(1) << single.elapsedMs << " ms"
+              << "  parallel : " << parallel.elapsedMs << " ms"
+              << "  merge " << (same ? "matches" : "MISMATCH") << "\n";
+    return same ? 0 : 1;
+}
+
+// Isinmadan sonra listener ve sim thread'lerinde heap ayirmasi olmamali.
+// /DJL_TRACK_ALLOCATIONS=1 ile derlenmelidir; aksi halde yalnizca uyari yazar.
+// Tum loglar acik (eksen, buton, tus, hold) ve dosyaya yazilir ki format yollari da denensin.
+int mainAllocationCheck(int warmupMs = 1000, int durationS = 5)
+{
+    SyntheticInputConfig config;
+    config.sampleRateHz = 2000.0;
+    config.axes[0].waveform = AxisWaveform::Sine;
+    config.axes[1].waveform = AxisWaveform::Chirp;
+    config.axes[1].chirpEndHz = 50.0;
+    config.axes[5].waveform = AxisWaveform::Step;
+    config.buttonStormRateHz = 200.0;
+    config.keyFloodRateHz = 200.0;
+
+    CSyntheticInputSource joySource(config);
+    CSyntheticInputSource diSource(config);
+    CAircraft aircraft;
+
+    auto joyLog = std::make_shared<std::ofstream>("alloc_check_joy.log", std::ios::trunc);
+    auto diLog = std::make_shared<std::ofstream>("alloc_check_di.log", std::ios::trunc);
+
+    CJoystickListener joystick(0);
+    joystick.SetNormalize(true);
+    joystick.SetLogger(joyLog);
+    joystick.SetSilentMode(false, false, false);
+    joystick.SetInputSource(&joySource);
+    joystick.SetPollPeriod(std::chrono::milliseconds(1));
+    joystick.SetAxisHandler([&aircraft](double x, double y, double z, double pov, std::string_view povDir) {
+        aircraft.PostCommand(AircraftCommand::FromAxes(x, y, z, 0));
+        });
+
+    CJoystickListenerDI joystickDI(GUID{});
+    joystickDI.SetNormalize(true);
+    joystickDI.SetLogger(diLog);
+    joystickDI.SetSilentMode(false, false, false);
+    joystickDI.SetInputSource(&diSource);
+    joystickDI.SetPollPeriod(std::chrono::milliseconds(1));
+    joystickDI.SetAxisHandler([&aircraft](double x, double y, double z, double rz, double pov, std::string_view povDir) {
+        aircraft.PostCommand(AircraftCommand::FromAxes(x, y, z, rz));
+        });
+
+    CKeyboardListener keyboard;
+    keyboard.SetLogger(std::make_shared<FileLogger>("alloc_check_keys.log"));
+    keyboard.SetSilentMode(false);
+    keyboard.SetInputSource(&joySource);
+    keyboard.SetPollPeriod(std::chrono::milliseconds(1));
+    keyboard.Init();
+
+    std::atomic<bool> simRunning(true);
+    std::thread sim([&aircraft, &simRunning]() {
+        JL_ALLOC_THREAD("Sim");
+        CLoopPacer simPacer(std::chrono::milliseconds(1));
+        while (simRunning)
+        {
+            simPacer.Wait();
+            aircraft.Update();
+        }
+        });
+
+    joySource.Start();
+    diSource.Start();
+    joystick.Start();
+    joystickDI.Start();
+    keyboard.Start();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(warmupMs));
+    CAllocationTracker::Arm();
+    std::this_thread::sleep_for(std::chrono::seconds(durationS));
+    CAllocationTracker::Disarm();
+
+    joySource.Stop();
+    diSource.Stop();
+    joystick.Stop();
+    joystickDI.Stop();
+    keyboard.Stop();
+    simRunning = false;
+    sim.join();
+
+    const AllocationReport report = CAllocationTracker::Report();
+    report.Print(std::cout);
+    joystick.GetMetricsSnapshot().Print(std::cout);
+    joystickDI.GetMetricsSnapshot().Print(std::cout);
+    keyboard.GetMetricsSnapshot().Print(std::cout);
+
+    return report.compiledIn && report.Clean() ? 0 : 1;
+}
+
+// Callback lambdalari ve SetExternalObject yerine coroutine script'leri.
+// Script'ler sim thread'inde, scheduler.Tick() icinde devam eder.
+static InputTask FlightControlScript(CJoystickListenerDI& listener, CAircraft& aircraft)
+{
+    for (;;)
+    {
+        InputEvent evt = co_await listener.NextButtonEdge();
+        if (evt.kind != InputEventKind::ButtonDown)
+            continue;
+
+        if (evt.code == 2)
+            aircraft.NeutralizeAll();
+        else if (evt.code == 7)
+            system("cls");
+    }
+}
+
+static InputTask BankWarningScript(CJoystickListenerDI& listener)
+{
+    for (;;)
+    {
+        InputEvent evt = co_await listener.AxisBeyond(JoystickState::AxisX, 0.9);
+        std::cout << "[Script] hard right bank : " << evt.value << "\n";
+
+        evt = co_await listener.AxisBeyond(JoystickState::AxisX, -0.9);
+        std::cout << "[Script] hard left bank : " << evt.value << "\n";
+    }
+}
+
+static InputTask AxisCommandScript(CJoystickListenerDI& listener, CAircraft& aircraft)
+{
+    for (;;)
+    {
+        InputEvent tick = co_await listener.GetScheduler()->NextTick();
+
+        // Poll yasini gizlemek icin eksenler tick anina tasinir (tahmin kapaliysa son ornek)
+        JoystickState state = listener.GetPredictedState(tick.timestampNs);
+        if (state.sequence == 0)
+            continue;
+
+        aircraft.PostCommand(AircraftCommand::FromAxes(state.axes[JoystickState::AxisX], state.axes[JoystickState::AxisY],
+            state.axes[JoystickState::AxisZ], state.axes[JoystickState::AxisRZ]));
+    }
+}
+
+int mainJoystickListenerDIWithScripts()
+{
+    CInputScheduler scheduler;
+    CAircraft aircraft;
+
+    auto guids = EnumerateJoysticks();
+
+    if (guids.empty())
+    {
+        std::cerr << "No DirectInput joystick found.\n";
+        return 1;
+    }
+
+    auto listener = std::make_shared<CJoystickListenerDI>(guids[0]);
+    listener->SetNormalize(true);
+    listener->SetScheduler(&scheduler);
+
+    PredictionConfig prediction;
+    prediction.enabled = true;
+    prediction.model = PredictionModel::Linear;
+    listener->SetPrediction(prediction);
+
+    if (!listener->Init())
+    {
+        std::cerr << "Joystick init failed.\n";
+        return 1;
+    }
+
+    FlightControlScript(*listener, aircraft);
+    BankWarningScript(*listener);
+    AxisCommandScript(*listener, aircraft);
+
+    listener->CalibrateCenter();
+    listener->Start();
+
+    CLoopPacer simPacer(std::chrono::milliseconds(1), std::chrono::microseconds(50));
+
+    while (listener->IsRunning())
+    {
+        simPacer.Wait();
+
+        if (GetAsyncKeyState(VK_ESCAPE) & 0x8000)
+        {
+            break;
+        }
+
+        scheduler.Tick();
+
+        aircraft.Update();
+
+        aircraft.PrintStatus();
+    }
+
+    listener->Stop();
+
+    std::cout << "[Scheduler] suspended coroutines : " << scheduler.GetSuspendedCount() << "\n";
 
     return 0;
 }
@@ -351,9 +1191,47 @@ int main()
     // Roll + Pitch + Yaw + Throttle, CAircraft
     return mainJoystickListenerDIWithAircraft();
 
+    // Roll + Pitch + Yaw + Throttle, CAircraft, std::function yerine derleme zamani sink
+    // return mainJoystickListenerDIWithAircraftSink();
+
+    // Roll + Pitch + Yaw + Throttle, CAircraft, coroutine script'leri
+    // return mainJoystickListenerDIWithScripts();
+
     // Roll + Pitch + Yaw + Throttle, 
     // return mainJoystickListenerDI();
+
+    // DIJOYSTATE2'nin tum eksenleri ve POV'lari, indeksle
+    // return mainJoystickListenerDIAxisVector();
  
     // Roll + Pitch + Throttle, 
     return mainJoystickListener();
+
+    // Kayitli oturumlar, golden yorunge karsilastirmasi
+    // return mainReplayHarness("replay");
+
+    // Tahmin modellerinin kayitli oturumdaki hatasi
+    // return mainPredictionTuning("session.jlss");
+
+    // Sentetik girdi ile stres testi
+    // return mainSyntheticStress(20000.0, 10);
+
+    // Input hub, uretici sayisiyla olcekleme
+    // return mainInputHubScaling(8);
+
+    // Eksen normalize: double ve Q15 (SSE2) yol karsilastirmasi
+    // return mainAxisPipelineBenchmark();
+
+    // Ucus veri kaydedicisi: 2 saatlik sanal ucus, sikistirma ve tarama suresi
+    // return mainFlightDataRecorder("flight.jlfd", 2.0);
+
+    // Kayitli oturum ve ucuslarin cok cekirdekli toplu analizi
+    // return mainSessionAnalyzer("recordings");
+
+    // Isinmadan sonra heap ayirmasi kontrolu (JL_TRACK_ALLOCATIONS=1)
+    // return mainAllocationCheck(1000, 5);
+
+    // Donen mmap log segmentlerini oku
+    // return mainDumpLog("stress_keys");
+
+    // Linux terminal klavyesi ve pseudo-terminal testi: TerminalKeyboardMain.cpp (ayri program)
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "Aircraft.h"
+#include "TraceRecorder.h"
 
 CAircraft::~CAircraft()
 {
@@ -21,7 +22,8 @@ CAircraft::CAircraft() :
     throttleCmd(0.0),
     iterCount(0),
     isRollingLeft(false), isRollingRight(false), isPitchingUp(false), isPitchingDown(false), 
-    isYawingLeft(false), isYawingRight(false), isThrottlingUp(false), isThrottlingDown(false)
+    isYawingLeft(false), isYawingRight(false), isThrottlingUp(false), isThrottlingDown(false),
+    lastConsumedPost(0)
 {
     currentTime = std::chrono::steady_clock::now();
     lastPrintTime = std::chrono::steady_clock::now();
@@ -96,8 +98,12 @@ double  CAircraft::GetSpeed(void)                   { return speedMPS;
 
 void CAircraft::Update(void)
 {
+    JL_TRACE_SCOPE("CAircraft::Update");
+
     incIterCount();
 
+    consumeCommands();
+
     if (isRollingLeft)     rollCmd--;
     if (isRollingRight)    rollCmd++;
     if (isPitchingUp)      pitchCmd++;
@@ -113,8 +119,81 @@ void CAircraft::NeutralizeAll(void)
     rollCmd = pitchCmd = yawCmd = throttleCmd = 0;
 }
 
+void CAircraft::PostCommand(const AircraftCommand& command)
+{
+    commandMailbox.Modify([&command](CommandSlot& slot) {
+        slot.postCount++;
+        for (int i = 0; i < AircraftCommand::FieldCount; ++i)
+        {
+            if (command.fields & (1u << i))
+                slot.fieldPost[i] = slot.postCount;
+        }
+
+        AircraftCommand& merged = slot.command;
+        if (command.fields & AircraftCommand::FieldRoll)           merged.rollCmd = command.rollCmd;
+        if (command.fields & AircraftCommand::FieldPitch)          merged.pitchCmd = command.pitchCmd;
+        if (command.fields & AircraftCommand::FieldYaw)            merged.yawCmd = command.yawCmd;
+        if (command.fields & AircraftCommand::FieldThrottle)       merged.throttleCmd = command.throttleCmd;
+        if (command.fields & AircraftCommand::FieldRollMotion)     merged.rollMotion = command.rollMotion;
+        if (command.fields & AircraftCommand::FieldPitchMotion)    merged.pitchMotion = command.pitchMotion;
+        if (command.fields & AircraftCommand::FieldYawMotion)      merged.yawMotion = command.yawMotion;
+        if (command.fields & AircraftCommand::FieldThrottleMotion) merged.throttleMotion = command.throttleMotion;
+        merged.fields |= command.fields;
+    });
+}
+
+// Son tick'ten beri yazilan alanlari bir kez uygular.
+void CAircraft::consumeCommands(void)
+{
+    CommandSlot slot;
+    commandMailbox.Load(slot);
+    if (slot.postCount == lastConsumedPost)
+        return;
+
+    uint32_t fresh = 0;
+    for (int i = 0; i < AircraftCommand::FieldCount; ++i)
+    {
+        if (slot.fieldPost[i] > lastConsumedPost)
+            fresh |= (1u << i);
+    }
+    lastConsumedPost = slot.postCount;
+
+    applyCommand(slot.command, fresh);
+}
+
+void CAircraft::applyCommand(const AircraftCommand& command, uint32_t fields)
+{
+    if (fields & AircraftCommand::FieldRoll)        rollCmd = command.rollCmd;
+    if (fields & AircraftCommand::FieldPitch)       pitchCmd = command.pitchCmd;
+    if (fields & AircraftCommand::FieldYaw)         yawCmd = command.yawCmd;
+    if (fields & AircraftCommand::FieldThrottle)    throttleCmd = command.throttleCmd;
+
+    if (fields & AircraftCommand::FieldRollMotion)
+    {
+        isRollingLeft     = command.rollMotion == AircraftCommand::MotionNegative;
+        isRollingRight    = command.rollMotion == AircraftCommand::MotionPositive;
+    }
+    if (fields & AircraftCommand::FieldPitchMotion)
+    {
+        isPitchingDown    = command.pitchMotion == AircraftCommand::MotionNegative;
+        isPitchingUp      = command.pitchMotion == AircraftCommand::MotionPositive;
+    }
+    if (fields & AircraftCommand::FieldYawMotion)
+    {
+        isYawingLeft      = command.yawMotion == AircraftCommand::MotionNegative;
+        isYawingRight     = command.yawMotion == AircraftCommand::MotionPositive;
+    }
+    if (fields & AircraftCommand::FieldThrottleMotion)
+    {
+        isThrottlingDown  = command.throttleMotion == AircraftCommand::MotionNegative;
+        isThrottlingUp    = command.throttleMotion == AircraftCommand::MotionPositive;
+    }
+}
+
 void CAircraft::PrintStatus(void) 
 {
+    JL_TRACE_SCOPE("CAircraft::PrintStatus");
+
     std::cout << "iterCount: " << std::setw(4) << iterCount;
     std::cout << "  [Aircraft Status] ";
     std::cout << "  Roll: " << std::setw(4) << std::fixed << std::setprecision(4) << rollCmd;
@@ -141,6 +220,8 @@ void CAircraft::incIterCount(void)
 
 void CAircraft::PrintFlighData(void)
 {
+    JL_TRACE_SCOPE("CAircraft::PrintFlighData");
+
     int iterCount = GetIterCount();
 
     // Ucagin guncel degerlerini al
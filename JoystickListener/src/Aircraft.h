@@ -14,6 +14,10 @@
 #include <thread>
 #include <mutex>
 #include <chrono>
+#include <cstdint>
+
+#include "AircraftCommand.h"
+#include "SeqLock.h"
 
 class CAircraft 
 {
@@ -93,6 +97,9 @@ public:
 
     virtual void    NeutralizeAll(void);
 
+    // Herhangi bir thread'den cagrilabilir; Update() bir sonraki tick'te uygular.
+    virtual void    PostCommand(const AircraftCommand& command);
+
     virtual void    PrintFlighData(void);
 
     virtual void    PrintStatus();
@@ -133,6 +140,19 @@ private:
 
     void incIterCount();
 
+    struct CommandSlot
+    {
+        AircraftCommand command;
+        uint64_t postCount;
+        uint64_t fieldPost[AircraftCommand::FieldCount];
+    };
+
+    void consumeCommands();
+    void applyCommand(const AircraftCommand& command, uint32_t fields);
+
+    CSeqLock<CommandSlot> commandMailbox;
+    uint64_t lastConsumedPost;
+
     std::chrono::time_point<std::chrono::steady_clock> lastPrintTime;
     std::chrono::time_point<std::chrono::steady_clock> currentTime;
 };
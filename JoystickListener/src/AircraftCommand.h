@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+
+// CAircraft'a listener thread'lerinden gonderilen komut seti.
+// Sadece fields maskesinde isaretli alanlar uygulanir; boylece klavye ve
+// joystick ayni posta kutusuna birbirinin alanlarini ezmeden yazabilir.
+struct AircraftCommand
+{
+    enum Field : uint32_t
+    {
+        FieldRoll           = 1u << 0,
+        FieldPitch          = 1u << 1,
+        FieldYaw            = 1u << 2,
+        FieldThrottle       = 1u << 3,
+        FieldRollMotion     = 1u << 4,
+        FieldPitchMotion    = 1u << 5,
+        FieldYawMotion      = 1u << 6,
+        FieldThrottleMotion = 1u << 7
+    };
+
+    static const int FieldCount = 8;
+
+    // Start/Stop bayraklari: -1 (Left/Down), 0 (Stop), +1 (Right/Up)
+    enum Motion : int8_t
+    {
+        MotionNegative = -1,
+        MotionStop     = 0,
+        MotionPositive = 1
+    };
+
+    uint32_t fields = 0;
+
+    double rollCmd = 0.0;
+    double pitchCmd = 0.0;
+    double yawCmd = 0.0;
+    double throttleCmd = 0.0;
+
+    int8_t rollMotion = MotionStop;
+    int8_t pitchMotion = MotionStop;
+    int8_t yawMotion = MotionStop;
+    int8_t throttleMotion = MotionStop;
+
+    AircraftCommand& SetRoll(double value)         { rollCmd = value;       fields |= FieldRoll;           return *this; }
+    AircraftCommand& SetPitch(double value)        { pitchCmd = value;      fields |= FieldPitch;          return *this; }
+    AircraftCommand& SetYaw(double value)          { yawCmd = value;        fields |= FieldYaw;            return *this; }
+    AircraftCommand& SetThrottle(double value)     { throttleCmd = value;   fields |= FieldThrottle;       return *this; }
+
+    AircraftCommand& SetRollMotion(Motion m)       { rollMotion = m;        fields |= FieldRollMotion;     return *this; }
+    AircraftCommand& SetPitchMotion(Motion m)      { pitchMotion = m;       fields |= FieldPitchMotion;    return *this; }
+    AircraftCommand& SetYawMotion(Motion m)        { yawMotion = m;         fields |= FieldYawMotion;      return *this; }
+    AircraftCommand& SetThrottleMotion(Motion m)   { throttleMotion = m;    fields |= FieldThrottleMotion; return *this; }
+
+    // Joystick eksenlerinden komut; canli dongu ve replay ayni eslemeyi kullanir.
+    static AircraftCommand FromAxes(double roll, double pitch, double throttle, double yaw)
+    {
+        AircraftCommand cmd;
+        cmd.SetRoll(roll).SetPitch(pitch).SetThrottle(throttle).SetYaw(yaw);
+        return cmd;
+    }
+};
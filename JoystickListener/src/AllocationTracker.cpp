@@ -0,0 +1,217 @@
+#include "AllocationTracker.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+namespace
+{
+    struct ThreadSlot
+    {
+        char name[32];
+        std::atomic<uint64_t> allocations;
+        std::atomic<uint64_t> bytes;
+        std::atomic<uint64_t> largest;
+    };
+
+    // Sabit baslatilir; static init sirasindaki operator new cagrilarinda da gecerli
+    ThreadSlot g_slots[CAllocationTracker::MaxThreads];
+    std::atomic<int> g_slotCount{ 0 };
+    std::atomic<bool> g_armed{ false };
+    std::atomic<uint64_t> g_otherAllocations{ 0 };
+    thread_local int t_slot = -1;
+
+    // Her slotun tek yazari sahibi thread'dir
+    void Bump(std::atomic<uint64_t>& counter, uint64_t n)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+    }
+}
+
+bool CAllocationTracker::RegisterThread(const char* threadName)
+{
+    if (t_slot >= 0)
+        return true;
+
+    const int slot = g_slotCount.fetch_add(1, std::memory_order_relaxed);
+    if (slot >= MaxThreads)
+    {
+        g_slotCount.store(MaxThreads, std::memory_order_relaxed);
+        return false;
+    }
+
+    ThreadSlot& s = g_slots[slot];
+    const char* name = threadName ? threadName : "";
+    size_t length = 0;
+    while (name[length] && length < sizeof(s.name) - 1)
+        ++length;
+    memcpy(s.name, name, length);
+    s.name[length] = '\0';
+    t_slot = slot;
+    return true;
+}
+
+void CAllocationTracker::Arm(void)
+{
+    const int count = g_slotCount.load(std::memory_order_relaxed);
+    for (int i = 0; i < count && i < MaxThreads; ++i)
+    {
+        g_slots[i].allocations.store(0, std::memory_order_relaxed);
+        g_slots[i].bytes.store(0, std::memory_order_relaxed);
+        g_slots[i].largest.store(0, std::memory_order_relaxed);
+    }
+    g_otherAllocations.store(0, std::memory_order_relaxed);
+    g_armed.store(true, std::memory_order_release);
+}
+
+void CAllocationTracker::Disarm(void)
+{
+    g_armed.store(false, std::memory_order_release);
+}
+
+bool CAllocationTracker::IsArmed(void)
+{
+    return g_armed.load(std::memory_order_relaxed);
+}
+
+void CAllocationTracker::OnAllocate(size_t size)
+{
+    if (!g_armed.load(std::memory_order_relaxed))
+        return;
+
+    const int slot = t_slot;
+    if (slot < 0)
+    {
+        g_otherAllocations.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    ThreadSlot& s = g_slots[slot];
+    Bump(s.allocations, 1);
+    Bump(s.bytes, size);
+    if (size > s.largest.load(std::memory_order_relaxed))
+        s.largest.store(size, std::memory_order_relaxed);
+}
+
+AllocationReport CAllocationTracker::Report(void)
+{
+    AllocationReport report;
+    report.compiledIn = JL_TRACK_ALLOCATIONS != 0;
+    report.threadCount = g_slotCount.load(std::memory_order_relaxed);
+    if (report.threadCount > MaxThreads)
+        report.threadCount = MaxThreads;
+
+    for (int i = 0; i < report.threadCount; ++i)
+    {
+        AllocationThreadReport& t = report.threads[i];
+        memcpy(t.name, g_slots[i].name, sizeof(t.name));
+        t.allocations = g_slots[i].allocations.load(std::memory_order_relaxed);
+        t.bytes = g_slots[i].bytes.load(std::memory_order_relaxed);
+        t.largest = g_slots[i].largest.load(std::memory_order_relaxed);
+    }
+    report.otherAllocations = g_otherAllocations.load(std::memory_order_relaxed);
+    return report;
+}
+
+bool AllocationReport::Clean(void) const
+{
+    for (int i = 0; i < threadCount; ++i)
+    {
+        if (threads[i].allocations != 0)
+            return false;
+    }
+    return true;
+}
+
+void AllocationReport::Print(std::ostream& os) const
+{
+    if (!compiledIn)
+    {
+        os << "[Alloc] tracking not compiled in (JL_TRACK_ALLOCATIONS=1)\n";
+        return;
+    }
+
+    os << "[Alloc] " << (Clean() ? "clean" : "ALLOCATING") << "  other threads : " << otherAllocations << "\n";
+    for (int i = 0; i < threadCount; ++i)
+    {
+        const AllocationThreadReport& t = threads[i];
+        os << "  " << t.name << " : " << t.allocations << " allocations, " << t.bytes << " bytes"
+           << " (largest " << t.largest << ")\n";
+    }
+}
+
+#if JL_TRACK_ALLOCATIONS
+
+namespace
+{
+    void* AlignedAllocate(size_t size, size_t alignment)
+    {
+#ifdef _MSC_VER
+        return _aligned_malloc(size ? size : 1, alignment);
+#else
+        const size_t rounded = ((size ? size : 1) + alignment - 1) / alignment * alignment;
+        return std::aligned_alloc(alignment, rounded);
+#endif
+    }
+
+    void AlignedFree(void* p)
+    {
+#ifdef _MSC_VER
+        _aligned_free(p);
+#else
+        std::free(p);
+#endif
+    }
+
+    void* Allocate(size_t size)
+    {
+        CAllocationTracker::OnAllocate(size);
+        void* p = std::malloc(size ? size : 1);
+        if (!p)
+            throw std::bad_alloc();
+        return p;
+    }
+
+    void* AllocateAligned(size_t size, std::align_val_t alignment)
+    {
+        CAllocationTracker::OnAllocate(size);
+        void* p = AlignedAllocate(size, static_cast<size_t>(alignment));
+        if (!p)
+            throw std::bad_alloc();
+        return p;
+    }
+}
+
+void* operator new(size_t size)                                     { return Allocate(size);   }
+void* operator new[](size_t size)                                   { return Allocate(size);   }
+void* operator new(size_t size, const std::nothrow_t&) noexcept     { CAllocationTracker::OnAllocate(size); return std::malloc(size ? size : 1); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept   { CAllocationTracker::OnAllocate(size); return std::malloc(size ? size : 1); }
+
+void operator delete(void* p) noexcept                              { std::free(p); }
+void operator delete[](void* p) noexcept                            { std::free(p); }
+void operator delete(void* p, size_t) noexcept                      { std::free(p); }
+void operator delete[](void* p, size_t) noexcept                    { std::free(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept       { std::free(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept     { std::free(p); }
+
+void* operator new(size_t size, std::align_val_t alignment)         { return AllocateAligned(size, alignment); }
+void* operator new[](size_t size, std::align_val_t alignment)       { return AllocateAligned(size, alignment); }
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    CAllocationTracker::OnAllocate(size);
+    return AlignedAllocate(size, static_cast<size_t>(alignment));
+}
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    CAllocationTracker::OnAllocate(size);
+    return AlignedAllocate(size, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* p, std::align_val_t) noexcept                            { AlignedFree(p); }
+void operator delete[](void* p, std::align_val_t) noexcept                          { AlignedFree(p); }
+void operator delete(void* p, size_t, std::align_val_t) noexcept                    { AlignedFree(p); }
+void operator delete[](void* p, size_t, std::align_val_t) noexcept                  { AlignedFree(p); }
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept     { AlignedFree(p); }
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept   { AlignedFree(p); }
+
+#endif
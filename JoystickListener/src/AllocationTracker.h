@@ -0,0 +1,63 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+
+// JL_TRACK_ALLOCATIONS=1 derlemede global operator new/delete degistirilir ve kayitli
+// thread'lerdeki heap ayirmalari sayilir (orn. /DJL_TRACK_ALLOCATIONS=1).
+// Varsayilan 0: hicbir sey degistirilmez, JL_ALLOC_THREAD bos makrodur.
+#ifndef JL_TRACK_ALLOCATIONS
+#define JL_TRACK_ALLOCATIONS 0
+#endif
+
+struct AllocationThreadReport
+{
+    char     name[32] = {};
+    uint64_t allocations = 0;
+    uint64_t bytes = 0;
+    uint64_t largest = 0;
+};
+
+struct AllocationReport
+{
+    static const int MaxThreads = 32;
+
+    bool     compiledIn = false;
+    int      threadCount = 0;
+    AllocationThreadReport threads[MaxThreads];
+    uint64_t otherAllocations = 0;      // kayitsiz thread'ler (main, logger, ...)
+
+    // Kayitli thread'lerin hicbiri ayirma yapmadiysa true
+    bool Clean(void) const;
+    void Print(std::ostream& os) const;
+};
+
+// Thread'ler baslangicta adlariyla kaydolur; isinmadan sonra Arm() cagrilir ve
+// o andan itibaren her operator new cagiran thread'in sayacini arttirir.
+// Kayit ve sayma hic ayirma yapmaz (sabit tablo, thread_local indeks).
+class CAllocationTracker
+{
+public:
+    static const int MaxThreads = AllocationReport::MaxThreads;
+
+    // Cagiran thread; tablo doluysa false
+    static bool RegisterThread(const char* threadName);
+
+    // Sayaclari sifirlar ve saymaya baslar
+    static void Arm(void);
+    static void Disarm(void);
+    static bool IsArmed(void);
+
+    static AllocationReport Report(void);
+
+    // operator new'den
+    static void OnAllocate(size_t size);
+};
+
+#if JL_TRACK_ALLOCATIONS
+#define JL_ALLOC_THREAD(name) CAllocationTracker::RegisterThread(name)
+#else
+#define JL_ALLOC_THREAD(name) ((void)0)
+#endif
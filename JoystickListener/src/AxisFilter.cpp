@@ -0,0 +1,182 @@
+#include "AxisFilter.h"
+
+#include <cmath>
+
+static const double Pi = 3.141592653589793;
+
+COneEuroFilter::COneEuroFilter()
+    : m_minCutoff(1.0), m_beta(0.0), m_dCutoff(1.0),
+    m_initialized(false), m_x(0.0), m_dx(0.0), m_lastNs(0)
+{
+}
+
+void COneEuroFilter::SetParameters(double minCutoff, double beta, double dCutoff)
+{
+    m_minCutoff = minCutoff;
+    m_beta = beta;
+    m_dCutoff = dCutoff;
+}
+
+void COneEuroFilter::Reset(void)
+{
+    m_initialized = false;
+    m_x = 0.0;
+    m_dx = 0.0;
+    m_lastNs = 0;
+}
+
+double COneEuroFilter::Alpha(double cutoff, double dt)
+{
+    const double tau = 1.0 / (2.0 * Pi * cutoff);
+    return 1.0 / (1.0 + tau / dt);
+}
+
+double COneEuroFilter::Filter(double value, int64_t timestampNs)
+{
+    if (!m_initialized)
+    {
+        m_initialized = true;
+        m_x = value;
+        m_dx = 0.0;
+        m_lastNs = timestampNs;
+        return m_x;
+    }
+
+    double dt = static_cast<double>(timestampNs - m_lastNs) * 1e-9;
+    if (dt <= 0.0)
+        dt = 1e-3;
+    m_lastNs = timestampNs;
+
+    const double dx = (value - m_x) / dt;
+    m_dx += Alpha(m_dCutoff, dt) * (dx - m_dx);
+
+    const double cutoff = m_minCutoff + m_beta * std::fabs(m_dx);
+    m_x += Alpha(cutoff, dt) * (value - m_x);
+    return m_x;
+}
+
+CAxisFilterStage::CAxisFilterStage()
+{
+    for (int a = 0; a < JoystickState::MaxAxes; ++a)
+    {
+        m_samples[a].store(0, std::memory_order_relaxed);
+        m_suppressed[a].store(0, std::memory_order_relaxed);
+        m_spikesRejected[a].store(0, std::memory_order_relaxed);
+    }
+    Reset();
+}
+
+void CAxisFilterStage::SetConfig(const AxisFilterConfig& config)
+{
+    m_config = config;
+    for (COneEuroFilter& filter : m_filters)
+        filter.SetParameters(config.minCutoffHz, config.beta, config.dCutoffHz);
+    Reset();
+}
+
+void CAxisFilterStage::Reset(void)
+{
+    for (int a = 0; a < JoystickState::MaxAxes; ++a)
+    {
+        m_filters[a].Reset();
+        m_lastEmitted[a] = 0.0;
+        m_hasEmitted[a] = false;
+        m_lastRaw[a] = 0.0;
+        m_hasRaw[a] = false;
+        m_spikePending[a] = false;
+        m_pendingValue[a] = 0.0;
+        m_pendingNs[a] = 0;
+    }
+}
+
+bool CAxisFilterStage::Process(int axis, double& value, int64_t timestampNs, bool rawChanged)
+{
+    if (axis < 0 || axis >= JoystickState::MaxAxes)
+        return rawChanged;
+
+    Bump(m_samples[axis]);
+    COneEuroFilter& filter = m_filters[axis];
+
+    // Tek ornekli sicrama: son kabul edilen ham ornekten uzak ornek bekletilir. Sonraki ornek
+    // eski degere yakinsa bekleyen sicramadir ve atilir; degilse gercek hareket, once o uygulanir.
+    // Karsilastirma filtre cikisiyla degil ham ornekle; hizli surekli harekette filtre gecikmesi sicrama sayilmaz.
+    if (m_config.spikeThreshold > 0.0 && m_hasRaw[axis])
+    {
+        const bool far = std::fabs(value - m_lastRaw[axis]) > m_config.spikeThreshold;
+        if (m_spikePending[axis])
+        {
+            m_spikePending[axis] = false;
+            if (far)
+                filter.Filter(m_pendingValue[axis], m_pendingNs[axis]);
+            else
+                Bump(m_spikesRejected[axis]);
+        }
+        else if (far)
+        {
+            m_spikePending[axis] = true;
+            m_pendingValue[axis] = value;
+            m_pendingNs[axis] = timestampNs;
+            value = filter.GetValue();
+            return false;
+        }
+    }
+    m_lastRaw[axis] = value;
+    m_hasRaw[axis] = true;
+
+    value = filter.Filter(value, timestampNs);
+
+    if (!m_hasEmitted[axis] || std::fabs(value - m_lastEmitted[axis]) >= m_config.epsilon)
+    {
+        m_hasEmitted[axis] = true;
+        m_lastEmitted[axis] = value;
+        return true;
+    }
+
+    if (rawChanged)
+        Bump(m_suppressed[axis]);
+    return false;
+}
+
+AxisFilterStats CAxisFilterStage::GetStats(void) const
+{
+    AxisFilterStats stats;
+    for (int a = 0; a < JoystickState::MaxAxes; ++a)
+    {
+        stats.samples[a] = m_samples[a].load(std::memory_order_relaxed);
+        stats.suppressed[a] = m_suppressed[a].load(std::memory_order_relaxed);
+        stats.spikesRejected[a] = m_spikesRejected[a].load(std::memory_order_relaxed);
+    }
+    return stats;
+}
+
+uint64_t AxisFilterStats::TotalSuppressed(void) const
+{
+    uint64_t total = 0;
+    for (uint64_t n : suppressed)
+        total += n;
+    return total;
+}
+
+uint64_t AxisFilterStats::TotalSpikesRejected(void) const
+{
+    uint64_t total = 0;
+    for (uint64_t n : spikesRejected)
+        total += n;
+    return total;
+}
+
+void AxisFilterStats::Print(std::ostream& os, const char* name) const
+{
+    os << "[AxisFilter] " << name
+       << "  suppressed : " << TotalSuppressed()
+       << "  spikesRejected : " << TotalSpikesRejected() << "\n";
+    for (int a = 0; a < JoystickState::MaxAxes; ++a)
+    {
+        if (samples[a] == 0)
+            continue;
+        os << "  axis " << a
+           << "  samples : " << samples[a]
+           << "  suppressed : " << suppressed[a]
+           << "  spikes : " << spikesRejected[a] << "\n";
+    }
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+
+#include "JoystickState.h"
+
+// One Euro filtresi (Casiez ve ark.): hiz dusukken kesim frekansi minCutoff'a iner
+// (guclu yumusatma), hizli harekette beta ile yukselir (dusuk gecikme).
+class COneEuroFilter
+{
+public:
+    COneEuroFilter();
+
+    void SetParameters(double minCutoff, double beta, double dCutoff);
+    void Reset(void);
+
+    double Filter(double value, int64_t timestampNs);
+    double GetValue(void) const     { return m_x; }
+
+private:
+    static double Alpha(double cutoff, double dt);
+
+    double  m_minCutoff;
+    double  m_beta;
+    double  m_dCutoff;
+    bool    m_initialized;
+    double  m_x;
+    double  m_dx;
+    int64_t m_lastNs;
+};
+
+// Degerler listener'in axis handler'a verdigi birimdedir (normalize ise -1..1 / 0..1, degilse ham).
+struct AxisFilterConfig
+{
+    bool   enabled = false;
+    double minCutoffHz = 1.0;
+    double beta = 0.5;
+    double dCutoffHz = 1.0;
+    double epsilon = 0.002;         // son yayinlanan degerden bu kadar degismeyen eksen olay uretmez
+    double spikeThreshold = 0.0;    // 0: kapali. Son kabul edilen ham ornekten bundan buyuk sicrama bir
+                                    // ornek bekletilir; sonraki ornek eski degere donerse sicrama sayilip atilir
+};
+
+struct AxisFilterStats
+{
+    uint64_t samples[JoystickState::MaxAxes] = {};
+    uint64_t suppressed[JoystickState::MaxAxes] = {};       // ham deger degisti ama olay bastirildi
+    uint64_t spikesRejected[JoystickState::MaxAxes] = {};
+
+    uint64_t TotalSuppressed(void) const;
+    uint64_t TotalSpikesRejected(void) const;
+    void Print(std::ostream& os, const char* name) const;
+};
+
+// Listener basina eksen filtre asamasi. Process() listener thread'inden cagrilir,
+// istatistikler herhangi bir thread'den okunabilir. Config Start'tan once verilir.
+class CAxisFilterStage
+{
+public:
+    CAxisFilterStage();
+
+    void SetConfig(const AxisFilterConfig& config);
+    const AxisFilterConfig& GetConfig(void) const   { return m_config;           }
+    bool IsEnabled(void) const                      { return m_config.enabled;   }
+    void Reset(void);
+
+    // value yerinde filtrelenir; eksen icin olay uretilmesi gerekiyorsa true doner.
+    bool Process(int axis, double& value, int64_t timestampNs, bool rawChanged);
+
+    AxisFilterStats GetStats(void) const;
+
+private:
+    static void Bump(std::atomic<uint64_t>& counter)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    AxisFilterConfig m_config;
+
+    COneEuroFilter m_filters[JoystickState::MaxAxes];
+    double m_lastEmitted[JoystickState::MaxAxes];
+    bool   m_hasEmitted[JoystickState::MaxAxes];
+    double m_lastRaw[JoystickState::MaxAxes];          // son kabul edilen ham (filtre oncesi) deger
+    bool   m_hasRaw[JoystickState::MaxAxes];
+    bool   m_spikePending[JoystickState::MaxAxes];
+    double m_pendingValue[JoystickState::MaxAxes];
+    int64_t m_pendingNs[JoystickState::MaxAxes];
+
+    std::atomic<uint64_t> m_samples[JoystickState::MaxAxes];
+    std::atomic<uint64_t> m_suppressed[JoystickState::MaxAxes];
+    std::atomic<uint64_t> m_spikesRejected[JoystickState::MaxAxes];
+};
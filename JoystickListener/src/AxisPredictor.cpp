@@ -0,0 +1,145 @@
+#include "AxisPredictor.h"
+
+const char* PredictionModelName(PredictionModel model)
+{
+    switch (model)
+    {
+    case PredictionModel::Hold:      return "hold";
+    case PredictionModel::Linear:    return "linear";
+    case PredictionModel::Quadratic: return "quadratic";
+    }
+    return "?";
+}
+
+CAxisPredictor::CAxisPredictor()
+    : m_head(0), m_count(0)
+{
+}
+
+void CAxisPredictor::SetConfig(const PredictionConfig& config)
+{
+    m_config = config;
+    Reset();
+}
+
+void CAxisPredictor::Reset(void)
+{
+    m_head = 0;
+    m_count = 0;
+}
+
+void CAxisPredictor::Estimate(JoystickState& state)
+{
+    const int axisCount = state.axisCount < JoystickState::MaxAxes ? state.axisCount : JoystickState::MaxAxes;
+
+    // Ayni zaman damgali ornek oncekinin yerine gecer
+    if (m_count == 0 || state.timestampNs != At(0).timestampNs)
+    {
+        m_head = (m_head + 1) % HistorySize;
+        if (m_count < HistorySize)
+            ++m_count;
+    }
+
+    HistoryEntry& newest = m_history[m_head];
+    newest.timestampNs = state.timestampNs;
+    for (int a = 0; a < axisCount; ++a)
+        newest.axes[a] = state.axes[a];
+
+    for (int a = 0; a < JoystickState::MaxAxes; ++a)
+    {
+        state.axisRate[a] = 0.0;
+        state.axisAccel[a] = 0.0;
+    }
+
+    if (m_config.model == PredictionModel::Hold || m_count < 2)
+        return;
+
+    // Pencere icindeki en eski ornek; en az bir onceki ornek kullanilir
+    int oldest = 1;
+    while (oldest + 1 < m_count && state.timestampNs - At(oldest + 1).timestampNs <= m_config.windowNs)
+        ++oldest;
+
+    const HistoryEntry& s0 = At(oldest);
+    const double t0 = static_cast<double>(s0.timestampNs - state.timestampNs) * 1e-9;
+
+    // Kuadratik icin pencerenin ortasina en yakin ornek
+    int middle = 0;
+    if (m_config.model == PredictionModel::Quadratic && oldest >= 2)
+    {
+        const int64_t midNs = (s0.timestampNs + state.timestampNs) / 2;
+        middle = 1;
+        while (middle + 1 < oldest && At(middle + 1).timestampNs >= midNs)
+            ++middle;
+    }
+
+    if (middle == 0)
+    {
+        for (int a = 0; a < axisCount; ++a)
+            state.axisRate[a] = (newest.axes[a] - s0.axes[a]) / -t0;
+        return;
+    }
+
+    // Newton bolunmus farklari; t2 = 0 anina gore
+    const HistoryEntry& s1 = At(middle);
+    const double t1 = static_cast<double>(s1.timestampNs - state.timestampNs) * 1e-9;
+
+    for (int a = 0; a < axisCount; ++a)
+    {
+        const double f01 = (s1.axes[a] - s0.axes[a]) / (t1 - t0);
+        const double f12 = (newest.axes[a] - s1.axes[a]) / -t1;
+        const double f012 = (f12 - f01) / -t0;
+        state.axisRate[a] = f12 - f012 * t1;
+        state.axisAccel[a] = 2.0 * f012;
+    }
+}
+
+void CAxisPredictor::AxisRange(bool normalized, int axis, double& lo, double& hi)
+{
+    if (!normalized)
+    {
+        lo = 0.0;
+        hi = 65535.0;
+        return;
+    }
+
+    lo = axis == JoystickState::AxisZ ? 0.0 : -1.0;
+    hi = 1.0;
+}
+
+double CAxisPredictor::Predict(const JoystickState& state, int axis, int64_t queryTimeNs, const PredictionConfig& config, bool normalized)
+{
+    if (axis < 0 || axis >= JoystickState::MaxAxes)
+        return 0.0;
+
+    const double value = state.axes[axis];
+    if (config.model == PredictionModel::Hold || state.sequence == 0)
+        return value;
+
+    int64_t aheadNs = queryTimeNs - state.timestampNs;
+    if (aheadNs <= 0)
+        return value;
+    if (aheadNs > config.maxHorizonNs)
+        aheadNs = config.maxHorizonNs;
+
+    const double dt = static_cast<double>(aheadNs) * 1e-9;
+    double predicted = value + state.axisRate[axis] * dt;
+    if (config.model == PredictionModel::Quadratic)
+        predicted += 0.5 * state.axisAccel[axis] * dt * dt;
+
+    if (config.clamp)
+    {
+        double lo = 0.0, hi = 0.0;
+        AxisRange(normalized, axis, lo, hi);
+        predicted = predicted < lo ? lo : (predicted > hi ? hi : predicted);
+    }
+    return predicted;
+}
+
+void CAxisPredictor::PredictState(JoystickState& state, int64_t queryTimeNs, const PredictionConfig& config, bool normalized)
+{
+    for (int a = 0; a < state.axisCount && a < JoystickState::MaxAxes; ++a)
+        state.axes[a] = Predict(state, a, queryTimeNs, config, normalized);
+
+    if (queryTimeNs > state.timestampNs)
+        state.timestampNs = queryTimeNs;
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+
+#include "JoystickState.h"
+
+enum class PredictionModel : uint8_t
+{
+    Hold = 0,       // son ornek
+    Linear,         // deger + hiz * dt
+    Quadratic       // deger + hiz * dt + ivme * dt^2 / 2
+};
+
+const char* PredictionModelName(PredictionModel model);
+
+struct PredictionConfig
+{
+    bool            enabled = false;
+    PredictionModel model = PredictionModel::Linear;
+    int64_t         windowNs = 8000000;         // turevler bu pencere icindeki orneklerden kestirilir
+    int64_t         maxHorizonNs = 30000000;    // bundan uzak ileriye tahmin yapilmaz
+    bool            clamp = true;               // sonuc eksen araligina kirpilir
+};
+
+// Eksen degeri tahmini. Estimate() listener thread'inde her ornekte turevleri
+// JoystickState'e yazar; Predict() yayinlanan kopya uzerinde sadece birkac
+// carpma yapar, her frame ve her eksen icin cagrilabilir.
+class CAxisPredictor
+{
+public:
+    static const int HistorySize = 32;
+
+    CAxisPredictor();
+
+    void SetConfig(const PredictionConfig& config);
+    const PredictionConfig& GetConfig(void) const   { return m_config;           }
+    bool IsEnabled(void) const                      { return m_config.enabled;   }
+    void Reset(void);
+
+    // state.axes ve state.timestampNs dolu olmalidir; axisRate/axisAccel yazilir.
+    void Estimate(JoystickState& state);
+
+    static void AxisRange(bool normalized, int axis, double& lo, double& hi);
+
+    static double Predict(const JoystickState& state, int axis, int64_t queryTimeNs, const PredictionConfig& config, bool normalized);
+
+    // Tum eksenleri queryTimeNs anina tasir; timestampNs de guncellenir.
+    static void PredictState(JoystickState& state, int64_t queryTimeNs, const PredictionConfig& config, bool normalized);
+
+private:
+    struct HistoryEntry
+    {
+        int64_t timestampNs;
+        double  axes[JoystickState::MaxAxes];
+    };
+
+    const HistoryEntry& At(int age) const   { return m_history[(m_head - age + HistorySize) % HistorySize]; }
+
+    PredictionConfig m_config;
+
+    HistoryEntry m_history[HistorySize];
+    int m_head;
+    int m_count;
+};
@@ -0,0 +1,102 @@
+#include "AxisVector.h"
+
+#include <algorithm>
+#include <cstring>
+
+#if JL_AXIS_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+    uint32_t AllAxesMask(int axisCount)
+    {
+        return (axisCount >= 32) ? 0xFFFFFFFFu : ((1u << axisCount) - 1);
+    }
+}
+
+CAxisVectorProcessor::CAxisVectorProcessor()
+    : m_groupCount(0),
+    m_info(nullptr),
+    m_axisCount(0),
+    m_povCount(0),
+    m_presentMask(0)
+{
+    Reset();
+}
+
+void CAxisVectorProcessor::Configure(const AxisInfo* axes, int axisCount, int povCount, bool reverseUnipolar, const FixedAxisConfig& config)
+{
+    m_info = axes;
+    m_axisCount = std::clamp(axisCount, 0, static_cast<int>(AxisVector::MaxAxes));
+    m_povCount = std::clamp(povCount, 0, static_cast<int>(AxisVector::MaxPovs));
+    m_groupCount = (m_axisCount + GroupSize - 1) / GroupSize;
+    m_presentMask = AllAxesMask(m_axisCount);
+
+    for (int g = 0; g < m_groupCount; ++g)
+    {
+        const int first = g * GroupSize;
+        const int count = std::min(GroupSize, m_axisCount - first);
+        uint32_t unipolarMask = 0;
+        uint32_t signedMask = 0;
+        for (int i = 0; i < count; ++i)
+        {
+            if (axes[first + i].range == AxisRange::Unipolar)
+                unipolarMask |= 1u << i;
+            else if (axes[first + i].range == AxisRange::Signed)
+                signedMask |= 1u << i;
+        }
+        m_groups[g].ConfigureLanes(count, unipolarMask, reverseUnipolar ? unipolarMask : 0u, config, signedMask);
+    }
+}
+
+void CAxisVectorProcessor::SetPresentMask(uint32_t presentMask)
+{
+    m_presentMask = presentMask & AllAxesMask(m_axisCount);
+}
+
+void CAxisVectorProcessor::Reset(void)
+{
+    std::memset(m_prevRaw, 0, sizeof(m_prevRaw));
+    std::memset(m_prevPov, 0, sizeof(m_prevPov));
+}
+
+bool CAxisVectorProcessor::Process(AxisVector& vector)
+{
+    for (int g = 0; g < m_groupCount; ++g)
+        m_groups[g].Normalize(vector.raw + g * GroupSize, vector.q15 + g * GroupSize);
+
+    vector.axisCount = m_axisCount;
+    vector.povCount = m_povCount;
+    vector.info = m_info;
+    vector.presentMask = m_presentMask;
+    vector.changedMask = ChangeMask(m_prevRaw, vector.raw, m_axisCount) & m_presentMask;
+
+    uint32_t povChanged = 0;
+    for (int i = 0; i < m_povCount; ++i)
+        povChanged |= static_cast<uint32_t>(m_prevPov[i] != vector.pov[i]) << i;
+    vector.povChangedMask = povChanged;
+
+    std::memcpy(m_prevRaw, vector.raw, m_axisCount * sizeof(int32_t));
+    std::memcpy(m_prevPov, vector.pov, m_povCount * sizeof(uint32_t));
+
+    return vector.changedMask != 0 || povChanged != 0;
+}
+
+uint32_t CAxisVectorProcessor::ChangeMask(const int32_t* prev, const int32_t* curr, int count)
+{
+    uint32_t mask = 0;
+    int i = 0;
+#if JL_AXIS_SSE2
+    // 4 eksen bir karsilastirma; esit seritlerin isaret bitleri toplanip ters cevrilir
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128i equal = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(prev + i)),
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(curr + i)));
+        mask |= static_cast<uint32_t>(~_mm_movemask_ps(_mm_castsi128_ps(equal)) & 0xF) << i;
+    }
+#endif
+    for (; i < count; ++i)
+        mask |= static_cast<uint32_t>(prev[i] != curr[i]) << i;
+    return mask;
+}
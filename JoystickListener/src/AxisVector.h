@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+
+#include "FixedPointAxis.h"
+
+enum class AxisAspect : uint8_t
+{
+    Position = 0,
+    Velocity,
+    Acceleration,
+    Force
+};
+
+enum class AxisRange : uint8_t
+{
+    Bipolar = 0,    // merkez 0, -1..1
+    Unipolar,       // throttle/slider, 0..1 (Normalizer ters cevirirse ileri 1)
+    Signed          // ham deger zaten merkez 0 (-32767..32767, hiz/ivme/kuvvet); raw / 32767
+};
+
+// Eksen vektorundeki bir indeksin sabit bilgisi; Layout::VectorAxes tablosundan gelir.
+struct AxisInfo
+{
+    const char* name;
+    AxisAspect  aspect;
+    AxisRange   range;
+};
+
+// Cihazin tum eksenleri ve POV'lari indeksle; Layout'un tabloda tanimladigi sirayla.
+// Eksenler ham ve Q15 (1.0 = 32767) olarak birlikte tasinir.
+struct AxisVector
+{
+    static const int MaxAxes = 32;
+    static const int MaxPovs = 4;
+
+    int32_t  raw[MaxAxes] = {};
+    int16_t  q15[MaxAxes] = {};
+    uint32_t pov[MaxPovs] = {};         // ham; 0xFFFF / 0xFFFFFFFF merkez
+    int      axisCount = 0;
+    int      povCount = 0;
+
+    uint32_t presentMask = 0;           // bit i: cihazda eksen i var
+    uint32_t changedMask = 0;           // bit i: eksen i onceki ornege gore degisti
+    uint32_t povChangedMask = 0;
+
+    const AxisInfo* info = nullptr;     // axisCount eleman
+
+    int64_t  timestampNs = 0;
+    uint64_t sequence = 0;              // 0 ise henuz ornek yok
+
+    double Value(int i) const           { return CFixedAxisNormalizer::ToDouble(q15[i]); }
+    bool   IsPresent(int i) const       { return (presentMask >> i) & 1u; }
+    bool   HasChanged(int i) const      { return (changedMask >> i) & 1u; }
+};
+
+// Q15 normalize 8'lik gruplar halinde (grup basina bir SSE2 gecisi), degisim tespiti
+// tum vektor uzerinde karsilastirma maskesiyle; eksen eklemek dal eklemez.
+class CAxisVectorProcessor
+{
+public:
+    CAxisVectorProcessor();
+
+    void Configure(const AxisInfo* axes, int axisCount, int povCount, bool reverseUnipolar, const FixedAxisConfig& config);
+    void SetPresentMask(uint32_t presentMask);
+    void Reset(void);
+
+    // vector.raw ve vector.pov okunmus olmali; q15 ve maskeler doldurulur. Degisim varsa true.
+    bool Process(AxisVector& vector);
+
+    static uint32_t ChangeMask(const int32_t* prev, const int32_t* curr, int count);
+
+private:
+    static const int GroupSize = CFixedAxisNormalizer::MaxAxes;
+    static const int MaxGroups = AxisVector::MaxAxes / GroupSize;
+
+    CFixedAxisNormalizer m_groups[MaxGroups];
+    int m_groupCount;
+
+    const AxisInfo* m_info;
+    int m_axisCount;
+    int m_povCount;
+    uint32_t m_presentMask;
+
+    int32_t  m_prevRaw[AxisVector::MaxAxes];
+    uint32_t m_prevPov[AxisVector::MaxPovs];
+};
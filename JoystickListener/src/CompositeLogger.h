@@ -3,22 +3,76 @@
 #include <vector>
 #include <memory>
 #include <mutex>
+#include <atomic>
+#include <algorithm>
 
+// Sink listesi kopyala-degistir-yayinla ile: AddLogger/RemoveLogger listeyi kopyalayip yeni
+// listeyi atomik ham isaretciyle yayinlar. Log/LogBatch yalnizca bu isaretciyi okur; kilit ve
+// paylasilan sayaca yazma yok. Eski listeler okuyucu hala uzerinde olabilecegi icin
+// silinmez, logger yok edilene kadar saklanir: cikarilan bir sink de o zamana kadar yasar.
+// Ekle/cikar ayar zamaninda seyrek yapildigi icin birikim kucuktur.
 class CompositeLogger : public ILogger {
 public:
+    using SinkList = std::vector<std::shared_ptr<ILogger>>;
+
+    CompositeLogger() {
+        lists_.push_back(std::make_shared<const SinkList>());
+        sinks_.store(lists_.back().get(), std::memory_order_release);
+    }
+
+    CompositeLogger(const CompositeLogger&) = delete;
+    CompositeLogger& operator=(const CompositeLogger&) = delete;
+
     void AddLogger(std::shared_ptr<ILogger> logger) {
-        std::lock_guard<std::mutex> lock(mutex_);
-        loggers_.push_back(logger);
+        std::lock_guard<std::mutex> lock(writerMutex_);
+        auto next = std::make_shared<SinkList>(*lists_.back());
+        next->push_back(std::move(logger));
+        Publish(std::move(next));
     }
 
-    void Log(const std::string& message) override {
-        std::lock_guard<std::mutex> lock(mutex_);
-        for (const auto& logger : loggers_) {
+    bool RemoveLogger(const std::shared_ptr<ILogger>& logger) {
+        std::lock_guard<std::mutex> lock(writerMutex_);
+        const SinkList& current = *lists_.back();
+        auto it = std::find(current.begin(), current.end(), logger);
+        if (it == current.end()) {
+            return false;
+        }
+        auto next = std::make_shared<SinkList>(current);
+        next->erase(next->begin() + (it - current.begin()));
+        Publish(std::move(next));
+        return true;
+    }
+
+    std::shared_ptr<const SinkList> GetLoggers() const {
+        std::lock_guard<std::mutex> lock(writerMutex_);
+        return lists_.back();
+    }
+
+    void Log(std::string_view message) override {
+        const SinkList* sinks = sinks_.load(std::memory_order_acquire);
+        for (const auto& logger : *sinks) {
             logger->Log(message);
         }
     }
 
+    void LogBatch(std::span<const std::string_view> messages) override {
+        if (messages.empty()) {
+            return;
+        }
+        const SinkList* sinks = sinks_.load(std::memory_order_acquire);
+        for (const auto& logger : *sinks) {
+            logger->LogBatch(messages);
+        }
+    }
+
 private:
-    std::vector<std::shared_ptr<ILogger>> loggers_;
-    std::mutex mutex_;
-};
\ No newline at end of file
+    // writerMutex_ altinda
+    void Publish(std::shared_ptr<const SinkList> next) {
+        lists_.push_back(std::move(next));
+        sinks_.store(lists_.back().get(), std::memory_order_release);
+    }
+
+    std::atomic<const SinkList*> sinks_{nullptr};
+    std::vector<std::shared_ptr<const SinkList>> lists_;    // son eleman guncel liste
+    mutable std::mutex writerMutex_;
+};
@@ -5,11 +5,19 @@
 
 class ConsoleLogger : public ILogger {
 public:
-    void Log(const std::string& message) override {
+    void Log(std::string_view message) override {
         std::lock_guard<std::mutex> lock(mutex_);
         std::cout << message << std::endl;
     }
 
+    void LogBatch(std::span<const std::string_view> messages) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (std::string_view message : messages) {
+            std::cout << message << '\n';
+        }
+        std::cout.flush();
+    }
+
 private:
     std::mutex mutex_;
-};
\ No newline at end of file
+};
@@ -7,14 +7,24 @@ class FileLogger : public ILogger {
 public:
     FileLogger(const std::string& filename) : file_(filename, std::ios::app) {}
 
-    void Log(const std::string& message) override {
+    void Log(std::string_view message) override {
         std::lock_guard<std::mutex> lock(mutex_);
         if (file_.is_open()) {
             file_ << message << std::endl;
         }
     }
 
+    void LogBatch(std::span<const std::string_view> messages) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (file_.is_open()) {
+            for (std::string_view message : messages) {
+                file_ << message << '\n';
+            }
+            file_.flush();
+        }
+    }
+
 private:
     std::ofstream file_;
     std::mutex mutex_;
-};
\ No newline at end of file
+};
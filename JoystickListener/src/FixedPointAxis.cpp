@@ -0,0 +1,138 @@
+#include "FixedPointAxis.h"
+
+#include <algorithm>
+#include <cstring>
+
+#if JL_AXIS_SSE2
+#include <emmintrin.h>
+#endif
+
+CFixedAxisNormalizer::CFixedAxisNormalizer()
+    : m_axisCount(0)
+{
+    Configure(0, -1, true, FixedAxisConfig());
+}
+
+void CFixedAxisNormalizer::Configure(int axisCount, int throttleAxis, bool reverseThrottle, const FixedAxisConfig& config)
+{
+    const uint32_t throttleMask = (throttleAxis >= 0 && throttleAxis < MaxAxes) ? (1u << throttleAxis) : 0u;
+    ConfigureLanes(axisCount, throttleMask, reverseThrottle ? throttleMask : 0u, config);
+}
+
+void CFixedAxisNormalizer::ConfigureLanes(int axisCount, uint32_t unipolarMask, uint32_t reverseMask, const FixedAxisConfig& config, uint32_t signedMask)
+{
+    m_axisCount = std::clamp(axisCount, 0, static_cast<int>(MaxAxes));
+    m_config = config;
+    m_config.deadzone = std::clamp<int16_t>(config.deadzone, 0, 16383);
+
+    // Yukari yuvarlanir ki olu bolge disinin ucu tam 32767'ye ulassin; asan deger doygun toplamayla kirpilir
+    const int deadzone = m_config.deadzone;
+    const uint16_t gain = static_cast<uint16_t>(((static_cast<int64_t>(deadzone) << 16) + (32767 - deadzone) - 1) / (32767 - deadzone));
+
+    for (int i = 0; i < MaxAxes; ++i)
+    {
+        const bool throttle = (unipolarMask >> i) & 1u;
+        const bool isSigned = !throttle && ((signedMask >> i) & 1u);
+        m_bias[i] = isSigned ? 0 : 32768;
+        m_bipolarMask[i] = throttle ? 0 : -1;
+        m_reverseMask[i] = (throttle && ((reverseMask >> i) & 1u)) ? 0x7FFF : 0;
+        m_deadzone[i] = (throttle || isSigned) ? 0 : m_config.deadzone;
+        m_gain[i] = (throttle || isSigned) ? 0 : gain;
+    }
+}
+
+void CFixedAxisNormalizer::Normalize(const int32_t* raw, int16_t* out) const
+{
+    NormalizeBatch(raw, out, 1);
+}
+
+void CFixedAxisNormalizer::NormalizeBatch(const int32_t* raw, int16_t* out, size_t sampleCount) const
+{
+#if JL_AXIS_SSE2
+    const __m128i biasLo = _mm_load_si128(reinterpret_cast<const __m128i*>(m_bias));
+    const __m128i biasHi = _mm_load_si128(reinterpret_cast<const __m128i*>(m_bias + 4));
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i half = _mm_set1_epi16(16384);
+    const __m128i bipolarMask = _mm_load_si128(reinterpret_cast<const __m128i*>(m_bipolarMask));
+    const __m128i reverseMask = _mm_load_si128(reinterpret_cast<const __m128i*>(m_reverseMask));
+    const __m128i deadzone = _mm_load_si128(reinterpret_cast<const __m128i*>(m_deadzone));
+    const __m128i gain = _mm_load_si128(reinterpret_cast<const __m128i*>(m_gain));
+
+    const int axisCount = m_axisCount;
+    for (size_t s = 0; s < sampleCount; ++s, raw += axisCount, out += axisCount)
+    {
+        // 4 ve 8 eksen (DI, JoystickState) dogrudan yuklenir; digerleri tampondan
+        __m128i lo;
+        __m128i hi;
+        alignas(16) int32_t lanes[MaxAxes] = {};
+        if (axisCount == 4)
+        {
+            lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(raw));
+            hi = biasHi;
+        }
+        else if (axisCount == MaxAxes)
+        {
+            lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(raw));
+            hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(raw + 4));
+        }
+        else
+        {
+            std::memcpy(lanes, raw, axisCount * sizeof(int32_t));
+            lo = _mm_load_si128(reinterpret_cast<const __m128i*>(lanes));
+            hi = _mm_load_si128(reinterpret_cast<const __m128i*>(lanes + 4));
+        }
+
+        // v = raw - bias (32768 ya da isaretli seritte 0), doygun paketleme 16 bite kirpar
+        const __m128i v = _mm_packs_epi32(_mm_sub_epi32(lo, biasLo), _mm_sub_epi32(hi, biasHi));
+
+        // bipolar: |v| - olu bolge, olcek, isaret geri
+        const __m128i sign = _mm_srai_epi16(v, 15);
+        const __m128i magnitude = _mm_max_epi16(v, _mm_subs_epi16(zero, v));
+        const __m128i outside = _mm_subs_epu16(magnitude, deadzone);
+        const __m128i scaled = _mm_adds_epi16(outside, _mm_mulhi_epu16(outside, gain));
+        const __m128i bipolar = _mm_sub_epi16(_mm_xor_si128(scaled, sign), sign);
+
+        // throttle: (v >> 1) + 16384 = raw >> 1, ters ise 32767 - u
+        const __m128i unipolar = _mm_xor_si128(_mm_add_epi16(_mm_srai_epi16(v, 1), half), reverseMask);
+
+        const __m128i result = _mm_or_si128(_mm_and_si128(bipolarMask, bipolar), _mm_andnot_si128(bipolarMask, unipolar));
+
+        if (axisCount == 4)
+        {
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(out), result);
+        }
+        else if (axisCount == MaxAxes)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out), result);
+        }
+        else
+        {
+            alignas(16) int16_t values[MaxAxes];
+            _mm_store_si128(reinterpret_cast<__m128i*>(values), result);
+            std::memcpy(out, values, axisCount * sizeof(int16_t));
+        }
+    }
+#else
+    for (size_t s = 0; s < sampleCount; ++s)
+        NormalizeScalar(raw + s * m_axisCount, out + s * m_axisCount);
+#endif
+}
+
+void CFixedAxisNormalizer::NormalizeScalar(const int32_t* raw, int16_t* out) const
+{
+    for (int i = 0; i < m_axisCount; ++i)
+    {
+        const int v = std::clamp(raw[i] - m_bias[i], -32768, 32767);
+        if (m_bipolarMask[i])
+        {
+            const int magnitude = std::min(v < 0 ? -v : v, 32767);
+            const int outside = std::max(magnitude - m_deadzone[i], 0);
+            const int scaled = std::min(outside + ((outside * m_gain[i]) >> 16), 32767);
+            out[i] = static_cast<int16_t>(v < 0 ? -scaled : scaled);
+        }
+        else
+        {
+            out[i] = static_cast<int16_t>(((v >> 1) + 16384) ^ m_reverseMask[i]);
+        }
+    }
+}
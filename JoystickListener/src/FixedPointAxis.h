@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "JoystickState.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define JL_AXIS_SSE2 1
+#else
+#define JL_AXIS_SSE2 0
+#endif
+
+// Eksen cikis hassasiyeti. Double: float/double normalize (varsayilan).
+// Q15: tamsayi normalize, 1.0 = 32767; handler'lar ayni degeri double olarak alir.
+enum class AxisPrecision : uint8_t
+{
+    Double = 0,
+    Q15
+};
+
+struct FixedAxisConfig
+{
+    // Bipolar eksenlerde merkez olu bolgesi, Q15 biriminde (0..16383). Disi tam araliga olceklenir.
+    int16_t deadzone = 0;
+};
+
+// Ham eksenleri (0..65535) Q15'e cevirir: bipolar -32767..32767, throttle 0..32767.
+// Isaretli seritlerde ham deger zaten merkez 0'dir; kaydirma ve olu bolge uygulanmaz.
+// Tum hesap 16 bit tamsayi; SSE2 varsa bir ornegin tum eksenleri (en fazla 8) tek vektorde islenir.
+// Skaler yol ayni aritmetigi yapar, iki yol bit bit ayni sonucu verir.
+class CFixedAxisNormalizer
+{
+public:
+    static const int MaxAxes = JoystickState::MaxAxes;
+
+    CFixedAxisNormalizer();
+
+    void Configure(int axisCount, int throttleAxis, bool reverseThrottle, const FixedAxisConfig& config);
+
+    // Serit basina: unipolarMask bit i ise eksen i throttle gibi 0..32767, reverseMask bit i ise ters,
+    // signedMask bit i ise ham deger -32767..32767 olarak dogrudan alinir
+    void ConfigureLanes(int axisCount, uint32_t unipolarMask, uint32_t reverseMask, const FixedAxisConfig& config, uint32_t signedMask = 0);
+    const FixedAxisConfig& GetConfig(void) const    { return m_config; }
+
+    // raw ve out axisCount eleman
+    void Normalize(const int32_t* raw, int16_t* out) const;
+
+    // Ardisik sampleCount ornek (raw[s * axisCount + i]); sabitler dongu disinda bir kez yuklenir
+    void NormalizeBatch(const int32_t* raw, int16_t* out, size_t sampleCount) const;
+
+    // SSE2'siz referans yol
+    void NormalizeScalar(const int32_t* raw, int16_t* out) const;
+
+    static double ToDouble(int16_t value)           { return value * (1.0 / 32767.0); }
+    static bool HasSimd(void)                       { return JL_AXIS_SSE2 != 0; }
+
+private:
+    // Serit basina sabitler; SSE2 yolunda dogrudan yuklenir
+    alignas(16) int32_t  m_bias[MaxAxes];           // ham merkez: 32768, isaretli serit: 0
+    alignas(16) int16_t  m_bipolarMask[MaxAxes];    // bipolar serit: -1, throttle: 0
+    alignas(16) int16_t  m_reverseMask[MaxAxes];    // ters throttle: 0x7FFF (32767 - u == u ^ 0x7FFF)
+    alignas(16) int16_t  m_deadzone[MaxAxes];
+    alignas(16) uint16_t m_gain[MaxAxes];           // olu bolge sonrasi olcek - 1, Q16
+
+    int m_axisCount;
+    FixedAxisConfig m_config;
+};
@@ -0,0 +1,699 @@
+#include "FlightDataRecorder.h"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iomanip>
+
+#include "Aircraft.h"
+
+static const char FileMagic[4] = { 'J', 'L', 'F', 'D' };
+static const char BlockMagic[4] = { 'F', 'D', 'R', 'B' };
+static const char IndexMagic[4] = { 'F', 'D', 'R', 'I' };
+
+static const size_t StreamCount = 1 + FlightColumnCount;
+static const size_t BlockHeaderSize = 4 + 4 + 8 + 8 + 4 * StreamCount;
+static const size_t IndexEntrySize = 8 + 8 + 8 + 4 + 4;
+
+namespace
+{
+    const char* const ColumnNames[FlightColumnCount] = {
+        "Roll", "Pitch", "Yaw", "Throttle",
+        "RollCmd", "PitchCmd", "YawCmd", "ThrottleCmd",
+        "Heading", "Latitude", "Longitude", "Altitude", "Speed"
+    };
+
+    template<typename T>
+    void Put(std::vector<uint8_t>& out, const T& value)
+    {
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+        out.insert(out.end(), bytes, bytes + sizeof(T));
+    }
+
+    template<typename T>
+    T Get(const uint8_t* data)
+    {
+        T value;
+        std::memcpy(&value, data, sizeof(T));
+        return value;
+    }
+
+    uint64_t Zigzag(int64_t value)      { return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63); }
+    int64_t  Unzigzag(uint64_t value)   { return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1); }
+
+    // Tasmada tanimsiz davranis olmasin diye farklar isaretsiz aritmetikle
+    int64_t Sub(int64_t a, int64_t b)   { return static_cast<int64_t>(static_cast<uint64_t>(a) - static_cast<uint64_t>(b)); }
+    int64_t Add(int64_t a, int64_t b)   { return static_cast<int64_t>(static_cast<uint64_t>(a) + static_cast<uint64_t>(b)); }
+
+    void PutVarint(std::vector<uint8_t>& out, uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            out.push_back(static_cast<uint8_t>(value) | 0x80);
+            value >>= 7;
+        }
+        out.push_back(static_cast<uint8_t>(value));
+    }
+
+    bool GetVarint(const uint8_t*& data, const uint8_t* end, uint64_t& value)
+    {
+        value = 0;
+        for (int shift = 0; shift < 64 && data < end; shift += 7)
+        {
+            const uint8_t byte = *data++;
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0)
+                return true;
+        }
+        return false;
+    }
+
+    // Ikinci fark: sabit hizda (zaman damgasi) veya duzgun degisen seride cogunlukla 0 -> 1 bayt
+    void EncodeDeltaOfDelta(const int64_t* values, size_t count, std::vector<uint8_t>& out)
+    {
+        int64_t prev = 0;
+        int64_t prevDelta = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            const int64_t delta = Sub(values[i], prev);
+            PutVarint(out, Zigzag(Sub(delta, prevDelta)));
+            prev = values[i];
+            prevDelta = delta;
+        }
+    }
+
+    bool DecodeDeltaOfDelta(const uint8_t* data, const uint8_t* end, size_t count, int64_t* values)
+    {
+        int64_t prev = 0;
+        int64_t prevDelta = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            uint64_t encoded;
+            if (!GetVarint(data, end, encoded))
+                return false;
+            prevDelta = Add(prevDelta, Unzigzag(encoded));
+            prev = Add(prev, prevDelta);
+            values[i] = prev;
+        }
+        return true;
+    }
+
+    class CBitWriter
+    {
+    public:
+        explicit CBitWriter(std::vector<uint8_t>& out) : m_out(out), m_acc(0), m_bits(0) {}
+
+        void Write(uint64_t value, int count)
+        {
+            if (count > 32)
+            {
+                Write(value >> 32, count - 32);
+                count = 32;
+            }
+            m_acc = (m_acc << count) | (value & ((1ull << count) - 1));
+            m_bits += count;
+            while (m_bits >= 8)
+            {
+                m_bits -= 8;
+                m_out.push_back(static_cast<uint8_t>(m_acc >> m_bits));
+            }
+        }
+
+        void Flush(void)
+        {
+            if (m_bits > 0)
+                m_out.push_back(static_cast<uint8_t>(m_acc << (8 - m_bits)));
+            m_bits = 0;
+        }
+
+    private:
+        std::vector<uint8_t>& m_out;
+        uint64_t m_acc;
+        int m_bits;
+    };
+
+    class CBitReader
+    {
+    public:
+        CBitReader(const uint8_t* data, const uint8_t* end) : m_data(data), m_end(end), m_acc(0), m_bits(0) {}
+
+        uint64_t Read(int count)
+        {
+            if (count > 32)
+            {
+                const uint64_t high = Read(count - 32);
+                return (high << 32) | Read(32);
+            }
+            while (m_bits < count)
+            {
+                m_acc = (m_acc << 8) | (m_data < m_end ? *m_data++ : 0);
+                m_bits += 8;
+            }
+            m_bits -= count;
+            return (m_acc >> m_bits) & ((1ull << count) - 1);
+        }
+
+    private:
+        const uint8_t* m_data;
+        const uint8_t* m_end;
+        uint64_t m_acc;
+        int m_bits;
+    };
+
+    // Gorilla XOR: onceki degerle ayni -> '0'; anlamli bitler onceki pencereye sigiyorsa
+    // '10' + bitler; degilse '11' + 5 bit bastaki sifir + 6 bit uzunluk + bitler
+    void EncodeXor(const double* values, size_t count, std::vector<uint8_t>& out)
+    {
+        if (count == 0)
+            return;
+
+        CBitWriter writer(out);
+        uint64_t prev = std::bit_cast<uint64_t>(values[0]);
+        writer.Write(prev, 64);
+
+        int prevLeading = -1;
+        int prevTrailing = 0;
+        for (size_t i = 1; i < count; ++i)
+        {
+            const uint64_t current = std::bit_cast<uint64_t>(values[i]);
+            const uint64_t x = current ^ prev;
+            prev = current;
+
+            if (x == 0)
+            {
+                writer.Write(0, 1);
+                continue;
+            }
+
+            const int leading = std::min(std::countl_zero(x), 31);
+            const int trailing = std::countr_zero(x);
+            if (prevLeading >= 0 && leading >= prevLeading && trailing >= prevTrailing)
+            {
+                writer.Write(0x2, 2);
+                writer.Write(x >> prevTrailing, 64 - prevLeading - prevTrailing);
+            }
+            else
+            {
+                const int significant = 64 - leading - trailing;
+                writer.Write(0x3, 2);
+                writer.Write(static_cast<uint64_t>(leading), 5);
+                writer.Write(static_cast<uint64_t>(significant - 1), 6);
+                writer.Write(x >> trailing, significant);
+                prevLeading = leading;
+                prevTrailing = trailing;
+            }
+        }
+        writer.Flush();
+    }
+
+    void DecodeXor(const uint8_t* data, const uint8_t* end, size_t count, double* values)
+    {
+        if (count == 0)
+            return;
+
+        CBitReader reader(data, end);
+        uint64_t prev = reader.Read(64);
+        values[0] = std::bit_cast<double>(prev);
+
+        int prevLeading = 0;
+        int prevTrailing = 0;
+        for (size_t i = 1; i < count; ++i)
+        {
+            if (reader.Read(1) != 0)
+            {
+                if (reader.Read(1) != 0)
+                {
+                    prevLeading = static_cast<int>(reader.Read(5));
+                    prevTrailing = 64 - prevLeading - (static_cast<int>(reader.Read(6)) + 1);
+                }
+                prev ^= reader.Read(64 - prevLeading - prevTrailing) << prevTrailing;
+            }
+            values[i] = std::bit_cast<double>(prev);
+        }
+    }
+
+    int64_t Quantize(double value, double step)
+    {
+        // NaN/sonsuz kuantalanamaz; 0 yazilir
+        const double scaled = value / step;
+        if (!std::isfinite(scaled) || std::fabs(scaled) > 9.0e18)
+            return 0;
+        return std::llround(scaled);
+    }
+}
+
+const char* FlightColumnName(int column)
+{
+    return (column >= 0 && column < FlightColumnCount) ? ColumnNames[column] : "Unknown";
+}
+
+FlightDataFrame FlightDataFrame::Capture(CAircraft& aircraft, int64_t timestampNs)
+{
+    FlightDataFrame frame;
+    frame.timestampNs = timestampNs;
+    frame.values[FlightRoll] = aircraft.GetRoll();
+    frame.values[FlightPitch] = aircraft.GetPitch();
+    frame.values[FlightYaw] = aircraft.GetYaw();
+    frame.values[FlightThrottle] = aircraft.GetThrottle();
+    frame.values[FlightRollCmd] = aircraft.GetRollCmd();
+    frame.values[FlightPitchCmd] = aircraft.GetPitchCmd();
+    frame.values[FlightYawCmd] = aircraft.GetYawCmd();
+    frame.values[FlightThrottleCmd] = aircraft.GetThrottleCmd();
+    frame.values[FlightHeading] = aircraft.GetHeading();
+    frame.values[FlightLatitude] = aircraft.GetLatitude();
+    frame.values[FlightLongitude] = aircraft.GetLongitude();
+    frame.values[FlightAltitude] = aircraft.GetAltitude();
+    frame.values[FlightSpeed] = aircraft.GetSpeed();
+    return frame;
+}
+
+void FlightRecorderStats::Print(std::ostream& os) const
+{
+    os << "[FlightRecorder] frames : " << frames << "  dropped : " << droppedFrames << "  blocks : " << blocks
+       << "  raw : " << rawBytes / 1024 << " KB  encoded : " << encodedBytes / 1024 << " KB"
+       << "  ratio : " << std::fixed << std::setprecision(1) << CompressionRatio() << "x\n";
+}
+
+CFlightDataRecorder::CFlightDataRecorder(const FlightRecorderConfig& config)
+    : m_config(config),
+    m_periodNs(static_cast<int64_t>(1e9 / std::max(config.sampleRateHz, 0.001))),
+    m_nextSampleNs(0),
+    m_freeBlocks(static_cast<size_t>(std::max(config.queueBlocks, 1))),
+    m_fullBlocks(static_cast<size_t>(std::max(config.queueBlocks, 1))),
+    m_currentBlock(-1),
+    m_running(false),
+    m_fileOffset(0),
+    m_frames(0),
+    m_droppedFrames(0),
+    m_blocksWritten(0),
+    m_encodedBytes(0)
+{
+    m_config.blockFrames = std::max(m_config.blockFrames, 1);
+    m_config.queueBlocks = std::max(m_config.queueBlocks, 1);
+
+    m_blocks.resize(m_config.queueBlocks);
+    for (int i = 0; i < m_config.queueBlocks; ++i)
+    {
+        m_blocks[i].frames.resize(m_config.blockFrames);
+        m_freeBlocks.TryPush(static_cast<uint32_t>(i));
+    }
+
+    for (std::vector<uint8_t>& stream : m_streams)
+        stream.reserve(m_config.blockFrames * sizeof(double));
+    m_quantized.resize(m_config.blockFrames);
+    m_column.resize(m_config.blockFrames);
+}
+
+CFlightDataRecorder::~CFlightDataRecorder()
+{
+    Stop();
+}
+
+bool CFlightDataRecorder::Start(void)
+{
+    if (m_running)
+        return true;
+
+    m_file.open(m_config.path, std::ios::binary | std::ios::trunc);
+    if (!m_file.is_open())
+        return false;
+
+    const uint32_t version = Version;
+    const uint32_t columnCount = FlightColumnCount;
+    const uint32_t blockFrames = static_cast<uint32_t>(m_config.blockFrames);
+    m_file.write(FileMagic, sizeof(FileMagic));
+    m_file.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    m_file.write(reinterpret_cast<const char*>(&columnCount), sizeof(columnCount));
+    m_file.write(reinterpret_cast<const char*>(&blockFrames), sizeof(blockFrames));
+    m_file.write(reinterpret_cast<const char*>(m_config.columnStep), sizeof(m_config.columnStep));
+    m_fileOffset = sizeof(FileMagic) + 3 * sizeof(uint32_t) + sizeof(m_config.columnStep);
+    m_encodedBytes = m_fileOffset;
+
+    m_index.clear();
+    m_nextSampleNs = 0;
+    m_running = true;
+    m_thread = std::thread(&CFlightDataRecorder::WriterLoop, this);
+    return true;
+}
+
+void CFlightDataRecorder::Stop(void)
+{
+    if (!m_running)
+        return;
+
+    SubmitCurrentBlock();
+    m_running = false;
+    m_wake.notify_one();
+    if (m_thread.joinable())
+        m_thread.join();
+}
+
+bool CFlightDataRecorder::IsRunning(void) const
+{
+    return m_running;
+}
+
+bool CFlightDataRecorder::Sample(CAircraft& aircraft, int64_t nowNs)
+{
+    if (!m_running || nowNs < m_nextSampleNs)
+        return false;
+
+    // Sabit hiz; bir periyottan fazla geride kalindiysa (duraklama) simdiden devam edilir
+    if (m_nextSampleNs == 0 || nowNs - m_nextSampleNs > m_periodNs)
+        m_nextSampleNs = nowNs + m_periodNs;
+    else
+        m_nextSampleNs += m_periodNs;
+
+    return Record(FlightDataFrame::Capture(aircraft, nowNs));
+}
+
+bool CFlightDataRecorder::Record(const FlightDataFrame& frame)
+{
+    if (!m_running)
+        return false;
+
+    if (m_currentBlock < 0)
+    {
+        uint32_t index;
+        if (!m_freeBlocks.TryPop(index))
+        {
+            m_droppedFrames.store(m_droppedFrames.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            return false;
+        }
+        m_currentBlock = static_cast<int>(index);
+    }
+
+    RawBlock& block = m_blocks[m_currentBlock];
+    block.frames[block.count++] = frame;
+    m_frames.store(m_frames.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+    if (block.count == m_config.blockFrames)
+        SubmitCurrentBlock();
+    return true;
+}
+
+void CFlightDataRecorder::SubmitCurrentBlock(void)
+{
+    if (m_currentBlock < 0)
+        return;
+
+    if (m_blocks[m_currentBlock].count > 0)
+    {
+        // Havuzdaki blok sayisi kuyruk kapasitesini asmaz, push basarisiz olmaz
+        m_fullBlocks.TryPush(static_cast<uint32_t>(m_currentBlock));
+        m_currentBlock = -1;
+        // Kilitsiz bildirim kacabilir; yazici en gec bekleme suresi sonunda kuyrugu bosaltir
+        m_wake.notify_one();
+    }
+}
+
+void CFlightDataRecorder::WriterLoop(void)
+{
+    while (true)
+    {
+        const bool running = m_running;
+
+        uint32_t index;
+        while (m_fullBlocks.TryPop(index))
+        {
+            WriteBlock(m_blocks[index]);
+            m_blocks[index].count = 0;
+            m_freeBlocks.TryPush(index);
+        }
+
+        if (!running)
+            break;
+
+        std::unique_lock<std::mutex> lock(m_wakeMutex);
+        m_wake.wait_for(lock, std::chrono::milliseconds(100));
+    }
+
+    WriteIndex();
+    m_file.close();
+}
+
+void CFlightDataRecorder::WriteBlock(const RawBlock& block)
+{
+    const size_t count = static_cast<size_t>(block.count);
+
+    for (std::vector<uint8_t>& stream : m_streams)
+        stream.clear();
+
+    for (size_t i = 0; i < count; ++i)
+        m_quantized[i] = block.frames[i].timestampNs;
+    EncodeDeltaOfDelta(m_quantized.data(), count, m_streams[0]);
+
+    // AoS -> sutun; her sutun kendi akisi, okuyucu yalnizca istedigini cozer
+    for (int c = 0; c < FlightColumnCount; ++c)
+    {
+        const double step = m_config.columnStep[c];
+        if (step > 0.0)
+        {
+            for (size_t i = 0; i < count; ++i)
+                m_quantized[i] = Quantize(block.frames[i].values[c], step);
+            EncodeDeltaOfDelta(m_quantized.data(), count, m_streams[1 + c]);
+        }
+        else
+        {
+            for (size_t i = 0; i < count; ++i)
+                m_column[i] = block.frames[i].values[c];
+            EncodeXor(m_column.data(), count, m_streams[1 + c]);
+        }
+    }
+
+    IndexEntry entry;
+    entry.firstNs = block.frames[0].timestampNs;
+    entry.lastNs = block.frames[count - 1].timestampNs;
+    entry.offset = m_fileOffset;
+    entry.frameCount = static_cast<uint32_t>(count);
+    entry.reserved = 0;
+
+    m_header.clear();
+    m_header.insert(m_header.end(), BlockMagic, BlockMagic + sizeof(BlockMagic));
+    Put(m_header, entry.frameCount);
+    Put(m_header, entry.firstNs);
+    Put(m_header, entry.lastNs);
+    size_t blockBytes = BlockHeaderSize;
+    for (const std::vector<uint8_t>& stream : m_streams)
+    {
+        Put(m_header, static_cast<uint32_t>(stream.size()));
+        blockBytes += stream.size();
+    }
+
+    m_file.write(reinterpret_cast<const char*>(m_header.data()), static_cast<std::streamsize>(m_header.size()));
+    for (const std::vector<uint8_t>& stream : m_streams)
+        m_file.write(reinterpret_cast<const char*>(stream.data()), static_cast<std::streamsize>(stream.size()));
+
+    m_fileOffset += blockBytes;
+    m_index.push_back(entry);
+    m_blocksWritten.store(m_index.size(), std::memory_order_relaxed);
+    m_encodedBytes.store(m_fileOffset, std::memory_order_relaxed);
+}
+
+void CFlightDataRecorder::WriteIndex(void)
+{
+    const uint64_t indexOffset = m_fileOffset;
+
+    m_header.clear();
+    m_header.insert(m_header.end(), IndexMagic, IndexMagic + sizeof(IndexMagic));
+    Put(m_header, static_cast<uint32_t>(m_index.size()));
+    for (const IndexEntry& entry : m_index)
+    {
+        Put(m_header, entry.firstNs);
+        Put(m_header, entry.lastNs);
+        Put(m_header, entry.offset);
+        Put(m_header, entry.frameCount);
+        Put(m_header, entry.reserved);
+    }
+    Put(m_header, indexOffset);
+
+    m_file.write(reinterpret_cast<const char*>(m_header.data()), static_cast<std::streamsize>(m_header.size()));
+    m_fileOffset += m_header.size();
+    m_encodedBytes.store(m_fileOffset, std::memory_order_relaxed);
+    m_file.flush();
+}
+
+FlightRecorderStats CFlightDataRecorder::GetStats(void) const
+{
+    FlightRecorderStats stats;
+    stats.frames = m_frames.load(std::memory_order_relaxed);
+    stats.droppedFrames = m_droppedFrames.load(std::memory_order_relaxed);
+    stats.blocks = m_blocksWritten.load(std::memory_order_relaxed);
+    stats.rawBytes = stats.frames * (sizeof(int64_t) + FlightColumnCount * sizeof(double));
+    stats.encodedBytes = m_encodedBytes.load(std::memory_order_relaxed);
+    return stats;
+}
+
+bool CFlightDataReader::Open(const std::string& path)
+{
+    m_storage.clear();
+    m_data = nullptr;
+    m_size = 0;
+
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open())
+        return false;
+
+    const std::streamoff size = file.tellg();
+    file.seekg(0);
+    m_storage.resize(static_cast<size_t>(size));
+    if (size > 0)
+        file.read(reinterpret_cast<char*>(m_storage.data()), size);
+    if (!file)
+        return false;
+
+    return Open(m_storage.data(), m_storage.size());
+}
+
+bool CFlightDataReader::Open(const uint8_t* data, size_t size)
+{
+    m_data = data;
+    m_size = size;
+    m_blocks.clear();
+    m_frameCount = 0;
+    m_hasIndex = false;
+    m_blockFrames = 0;
+
+    m_headerSize = sizeof(FileMagic) + 3 * sizeof(uint32_t) + sizeof(m_columnStep);
+    if (m_size < m_headerSize || std::memcmp(m_data, FileMagic, sizeof(FileMagic)) != 0)
+        return false;
+    if (Get<uint32_t>(m_data + 4) != CFlightDataRecorder::Version || Get<uint32_t>(m_data + 8) != FlightColumnCount)
+        return false;
+    m_blockFrames = Get<uint32_t>(m_data + 12);
+    std::memcpy(m_columnStep, m_data + 16, sizeof(m_columnStep));
+
+    m_hasIndex = ReadIndex();
+    if (!m_hasIndex)
+        ScanBlockHeaders();
+
+    for (const FlightBlockInfo& block : m_blocks)
+        m_frameCount += block.frameCount;
+    return true;
+}
+
+bool CFlightDataReader::ReadIndex(void)
+{
+    if (m_size < m_headerSize + 8 + 8)
+        return false;
+
+    // Ofset dosyanin sonundan gelir; toplama yerine kalan boyutla karsilastirilir ki tasmasin
+    const uint64_t indexOffset = Get<uint64_t>(m_data + m_size - 8);
+    if (indexOffset < m_headerSize || indexOffset > m_size - 16 ||
+        std::memcmp(m_data + indexOffset, IndexMagic, sizeof(IndexMagic)) != 0)
+        return false;
+
+    const uint32_t blockCount = Get<uint32_t>(m_data + indexOffset + 4);
+    if (static_cast<uint64_t>(blockCount) * IndexEntrySize != m_size - 16 - indexOffset)
+        return false;
+
+    m_blocks.resize(blockCount);
+    const uint8_t* entry = m_data + indexOffset + 8;
+    for (uint32_t i = 0; i < blockCount; ++i, entry += IndexEntrySize)
+    {
+        m_blocks[i].firstNs = Get<int64_t>(entry);
+        m_blocks[i].lastNs = Get<int64_t>(entry + 8);
+        m_blocks[i].offset = Get<uint64_t>(entry + 16);
+        m_blocks[i].frameCount = Get<uint32_t>(entry + 24);
+    }
+    return true;
+}
+
+void CFlightDataReader::ScanBlockHeaders(void)
+{
+    size_t offset = m_headerSize;
+    while (offset + BlockHeaderSize <= m_size && std::memcmp(m_data + offset, BlockMagic, sizeof(BlockMagic)) == 0)
+    {
+        uint64_t blockBytes = BlockHeaderSize;
+        for (size_t s = 0; s < StreamCount; ++s)
+            blockBytes += Get<uint32_t>(m_data + offset + 24 + 4 * s);
+        if (blockBytes > m_size - offset)
+            break;      // yarim kalan son blok
+
+        FlightBlockInfo block;
+        block.frameCount = Get<uint32_t>(m_data + offset + 4);
+        block.firstNs = Get<int64_t>(m_data + offset + 8);
+        block.lastNs = Get<int64_t>(m_data + offset + 16);
+        block.offset = offset;
+        m_blocks.push_back(block);
+        offset += static_cast<size_t>(blockBytes);
+    }
+}
+
+bool CFlightDataReader::ReadBlock(size_t blockIndex, uint32_t columnMask, FlightBlockData& data) const
+{
+    if (blockIndex >= m_blocks.size())
+        return false;
+
+    const uint64_t offset = m_blocks[blockIndex].offset;
+    if (offset > m_size || m_size - offset < BlockHeaderSize || std::memcmp(m_data + offset, BlockMagic, sizeof(BlockMagic)) != 0)
+        return false;
+
+    // Sayi dosyadan gelir; ayirmadan once basliktaki blok boyutu ve zaman damgasi akisiyla sinirlanir
+    // (her zaman damgasi en az bir varint bayti)
+    const size_t count = Get<uint32_t>(m_data + offset + 4);
+    if ((m_blockFrames > 0 && count > m_blockFrames) || count > Get<uint32_t>(m_data + offset + 24))
+        return false;
+
+    const uint8_t* stream = m_data + offset + BlockHeaderSize;
+    const uint8_t* end = m_data + m_size;
+
+    data.count = count;
+    data.timestampsNs.resize(count);
+
+    std::vector<int64_t> quantized;
+    for (size_t s = 0; s < StreamCount; ++s)
+    {
+        const uint32_t bytes = Get<uint32_t>(m_data + offset + 24 + 4 * s);
+        if (bytes > static_cast<size_t>(end - stream))
+            return false;
+
+        if (s == 0)
+        {
+            if (!DecodeDeltaOfDelta(stream, stream + bytes, count, data.timestampsNs.data()))
+                return false;
+        }
+        else if (columnMask & (1u << (s - 1)))
+        {
+            const int c = static_cast<int>(s - 1);
+            std::vector<double>& column = data.columns[c];
+            column.resize(count);
+            if (m_columnStep[c] > 0.0)
+            {
+                quantized.resize(count);
+                if (!DecodeDeltaOfDelta(stream, stream + bytes, count, quantized.data()))
+                    return false;
+                for (size_t i = 0; i < count; ++i)
+                    column[i] = static_cast<double>(quantized[i]) * m_columnStep[c];
+            }
+            else
+            {
+                DecodeXor(stream, stream + bytes, count, column.data());
+            }
+        }
+        else
+        {
+            data.columns[s - 1].clear();
+        }
+        stream += bytes;
+    }
+    return true;
+}
+
+uint64_t CFlightDataReader::Scan(int64_t beginNs, int64_t endNs, uint32_t columnMask,
+    const std::function<void(const FlightBlockData& data)>& visitor) const
+{
+    FlightBlockData data;
+    uint64_t frames = 0;
+    for (size_t i = 0; i < m_blocks.size(); ++i)
+    {
+        if (m_blocks[i].lastNs < beginNs || m_blocks[i].firstNs > endNs)
+            continue;
+        if (!ReadBlock(i, columnMask, data))
+            break;
+        visitor(data);
+        frames += data.count;
+    }
+    return frames;
+}
@@ -0,0 +1,207 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "SpscQueue.h"
+
+class CAircraft;
+
+enum FlightColumn
+{
+    FlightRoll = 0,
+    FlightPitch,
+    FlightYaw,
+    FlightThrottle,
+    FlightRollCmd,
+    FlightPitchCmd,
+    FlightYawCmd,
+    FlightThrottleCmd,
+    FlightHeading,
+    FlightLatitude,
+    FlightLongitude,
+    FlightAltitude,
+    FlightSpeed,
+    FlightColumnCount
+};
+
+const char* FlightColumnName(int column);
+
+// CAircraft'in bir andaki durumu; sutunlar FlightColumn sirasiyla.
+struct FlightDataFrame
+{
+    int64_t timestampNs;
+    double  values[FlightColumnCount];
+
+    static FlightDataFrame Capture(CAircraft& aircraft, int64_t timestampNs);
+};
+
+struct FlightRecorderConfig
+{
+    std::string path = "flight.jlfd";
+    double sampleRateHz = 50.0;     // Sample() bu hiza seyreltilir
+    int    blockFrames = 1024;      // blok basina ornek
+    int    queueBlocks = 8;         // yaziciya giden blok havuzu; dolarsa ornek dusurulur
+
+    // Sutun basina kuantalama adimi. 0: XOR float (kayipsiz), >0: deger/adim tamsayisi
+    // ikinci fark + zigzag varint. Varsayilanlar ekrandaki hassasiyetin altinda.
+    double columnStep[FlightColumnCount] = {
+        1e-5, 1e-5, 1e-5, 0.0,              // roll, pitch, yaw (derece), throttle
+        0.0, 0.0, 0.0, 0.0,                 // komutlar (cogunlukla sabit, XOR tek bit)
+        1e-5, 1e-7, 1e-7, 1e-3, 1e-3        // heading, lat/lon (~1 cm), alt (mm), hiz (mm/s)
+    };
+};
+
+struct FlightRecorderStats
+{
+    uint64_t frames = 0;
+    uint64_t droppedFrames = 0;
+    uint64_t blocks = 0;
+    uint64_t rawBytes = 0;          // zaman damgasi + double sutunlar olarak
+    uint64_t encodedBytes = 0;      // blok basliklari dahil
+
+    double CompressionRatio(void) const { return encodedBytes ? static_cast<double>(rawBytes) / encodedBytes : 0.0; }
+    void Print(std::ostream& os) const;
+};
+
+// Dosya:
+//   "JLFD" | uint32 version | uint32 columnCount | uint32 blockFrames | double columnStep[columnCount]
+//   blok*  : "FDRB" | uint32 frameCount | int64 firstNs | int64 lastNs | uint32 streamBytes[1 + columnCount]
+//            | zaman damgasi akisi | sutun akislari
+//   indeks : "FDRI" | uint32 blockCount | { int64 firstNs, int64 lastNs, uint64 offset, uint32 frameCount, uint32 reserved }*
+//            | uint64 indexOffset
+// Zaman damgalari ikinci fark + zigzag varint. Her blok bagimsiz cozulur; indeks yoksa
+// (yarim kalan kayit) okuyucu blok basliklarini sirayla tarar.
+class CFlightDataRecorder
+{
+public:
+    static const uint32_t Version = 1;
+
+    explicit CFlightDataRecorder(const FlightRecorderConfig& config = FlightRecorderConfig());
+    ~CFlightDataRecorder();
+
+    CFlightDataRecorder(const CFlightDataRecorder&) = delete;
+    CFlightDataRecorder& operator=(const CFlightDataRecorder&) = delete;
+
+    bool Start(void);
+    // Yarim blok ve indeks yazilir; Sample/Record cagiran thread durduktan sonra cagrilir.
+    void Stop(void);
+    bool IsRunning(void) const;
+
+    // Sim thread'inden (tek uretici). sampleRateHz'e gore seyreltilir; kaydedildiyse true.
+    // Isinmadan sonra heap kullanmaz, kodlama ve yazma arka plan thread'inde.
+    bool Sample(CAircraft& aircraft, int64_t nowNs);
+    bool Record(const FlightDataFrame& frame);
+
+    FlightRecorderStats GetStats(void) const;
+
+private:
+    struct RawBlock
+    {
+        std::vector<FlightDataFrame> frames;
+        int count = 0;
+    };
+
+    void WriterLoop(void);
+    void SubmitCurrentBlock(void);
+    void WriteBlock(const RawBlock& block);
+    void WriteIndex(void);
+
+    FlightRecorderConfig m_config;
+    int64_t m_periodNs;
+    int64_t m_nextSampleNs;
+
+    std::vector<RawBlock> m_blocks;
+    CSpscQueue<uint32_t> m_freeBlocks;      // yazici -> uretici
+    CSpscQueue<uint32_t> m_fullBlocks;      // uretici -> yazici
+    int m_currentBlock;
+
+    std::thread m_thread;
+    std::atomic<bool> m_running;
+    std::mutex m_wakeMutex;
+    std::condition_variable m_wake;
+
+    // Yazici thread'ine ait
+    std::ofstream m_file;
+    uint64_t m_fileOffset;
+    std::vector<uint8_t> m_streams[1 + FlightColumnCount];   // zaman damgasi + sutunlar
+    std::vector<uint8_t> m_header;
+    std::vector<int64_t> m_quantized;
+    std::vector<double>  m_column;
+    struct IndexEntry
+    {
+        int64_t  firstNs;
+        int64_t  lastNs;
+        uint64_t offset;
+        uint32_t frameCount;
+        uint32_t reserved;
+    };
+    std::vector<IndexEntry> m_index;
+
+    std::atomic<uint64_t> m_frames;
+    std::atomic<uint64_t> m_droppedFrames;
+    std::atomic<uint64_t> m_blocksWritten;
+    std::atomic<uint64_t> m_encodedBytes;
+};
+
+struct FlightBlockInfo
+{
+    int64_t  firstNs;
+    int64_t  lastNs;
+    uint64_t offset;
+    uint32_t frameCount;
+};
+
+// Cozulmus blok; columnMask'ta olmayan sutunlar bos kalir.
+struct FlightBlockData
+{
+    size_t count = 0;
+    std::vector<int64_t> timestampsNs;
+    std::vector<double>  columns[FlightColumnCount];
+};
+
+// Dosyanin tamamini bellege alir; indeksle zaman araligindaki bloklari, istenen sutunlari cozer.
+class CFlightDataReader
+{
+public:
+    bool Open(const std::string& path);
+
+    // Kopyalamadan bellekteki (orn. eslenmis) dosya uzerinde; data okuyucudan uzun yasamali.
+    bool Open(const uint8_t* data, size_t size);
+
+    const std::vector<FlightBlockInfo>& GetBlocks(void) const   { return m_blocks;      }
+    uint64_t GetFrameCount(void) const                          { return m_frameCount;  }
+    bool HasIndex(void) const                                   { return m_hasIndex;    }
+    const double* GetColumnSteps(void) const                    { return m_columnStep;  }
+
+    bool ReadBlock(size_t blockIndex, uint32_t columnMask, FlightBlockData& data) const;
+
+    // [beginNs, endNs] ile kesisen bloklar sirayla cozulur; aralik disindaki ornekler de blokta kalir.
+    // Ziyaret edilen ornek sayisini dondurur.
+    uint64_t Scan(int64_t beginNs, int64_t endNs, uint32_t columnMask,
+        const std::function<void(const FlightBlockData& data)>& visitor) const;
+
+    static const uint32_t AllColumns = (1u << FlightColumnCount) - 1;
+
+private:
+    bool ReadIndex(void);
+    void ScanBlockHeaders(void);
+
+    std::vector<uint8_t> m_storage;     // Open(path) ile okunduysa
+    const uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+    size_t m_headerSize = 0;
+    uint32_t m_blockFrames = 0;         // 0: eski dosya, ust sinir yalnizca akis boyutundan
+    double m_columnStep[FlightColumnCount] = {};
+    std::vector<FlightBlockInfo> m_blocks;
+    uint64_t m_frameCount = 0;
+    bool m_hasIndex = false;
+};
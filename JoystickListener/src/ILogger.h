@@ -1,8 +1,17 @@
 #pragma once
 #include <string>
+#include <string_view>
+#include <span>
 
 class ILogger {
 public:
     virtual ~ILogger() = default;
-    virtual void Log(const std::string& message) = 0;
-};
\ No newline at end of file
+    virtual void Log(std::string_view message) = 0;
+
+    // Bir cagrida birden cok satir; sink'ler kilidi/flush'i bir kez yapmak icin override eder.
+    virtual void LogBatch(std::span<const std::string_view> messages) {
+        for (std::string_view message : messages) {
+            Log(message);
+        }
+    }
+};
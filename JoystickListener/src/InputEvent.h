@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <functional>
+
+enum class InputEventKind : uint8_t
+{
+    ButtonDown = 0,
+    ButtonUp,
+    ButtonHeld,
+    Axis,
+    KeyDown,
+    KeyHold,
+    KeyUp
+};
+
+// Tum listener'larin ortak, zaman damgali olay tipi (16 bayt).
+// Bir poll'da uretilen olaylar tek bir diziye yazilir ve batch handler'a
+// tek span olarak verilir.
+struct InputEvent
+{
+    // Axis olaylari: code = JoystickState::Axis (X, Y, Z, RZ) veya PovCode
+    static const uint16_t PovCode = 8;
+
+    // Key olaylari: code = VK (alt 8 bit) | Mod* bitleri
+    static const uint16_t KeyCodeMask = 0x00FF;
+    static const uint16_t ModShift = 0x0100;
+    static const uint16_t ModCtrl  = 0x0200;
+    static const uint16_t ModAlt   = 0x0400;
+
+    static const uint8_t KeyboardDeviceId = 0xFF;
+
+    int64_t        timestampNs;     // CLoopPacer::NowNs() ile ayni monoton saat
+    float          value;           // buton/tus: 1 veya 0, Hold: basili kalma sayisi, eksen: listener'in verdigi deger
+    uint16_t       code;            // buton: 1 tabanli id
+    uint8_t        deviceId;
+    InputEventKind kind;
+
+    static InputEvent Make(int64_t timestampNs, uint8_t deviceId, InputEventKind kind, uint16_t code, float value)
+    {
+        InputEvent evt;
+        evt.timestampNs = timestampNs;
+        evt.value = value;
+        evt.code = code;
+        evt.deviceId = deviceId;
+        evt.kind = kind;
+        return evt;
+    }
+
+    int  KeyCode(void) const                { return code & KeyCodeMask;    }
+    bool HasModifier(uint16_t mod) const    { return (code & mod) != 0;     }
+};
+
+static_assert(sizeof(InputEvent) == 16, "InputEvent should stay compact");
+
+inline const char* InputEventKindName(InputEventKind kind)
+{
+    switch (kind)
+    {
+    case InputEventKind::ButtonDown: return "ButtonDown";
+    case InputEventKind::ButtonUp:   return "ButtonUp";
+    case InputEventKind::ButtonHeld: return "ButtonHeld";
+    case InputEventKind::Axis:       return "Axis";
+    case InputEventKind::KeyDown:    return "KeyDown";
+    case InputEventKind::KeyHold:    return "KeyHold";
+    case InputEventKind::KeyUp:      return "KeyUp";
+    }
+    return "Unknown";
+}
+
+// Bir poll/okuma sonucunda uretilen tum olaylar; span sadece cagri suresince gecerlidir.
+using InputBatchHandler = std::function<void(std::span<const InputEvent> events)>;
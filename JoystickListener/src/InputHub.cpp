@@ -0,0 +1,248 @@
+#include "InputHub.h"
+#include "LoopPacer.h"
+#include "TraceRecorder.h"
+
+#include <algorithm>
+#include <climits>
+#include <iomanip>
+
+namespace
+{
+    // std::push_heap max-heap kurar; en eski (kucuk damga, sonra erken gelis) tepede olsun
+    struct LaterFirst
+    {
+        template<typename P>
+        bool operator()(const P& a, const P& b) const
+        {
+            return a.timestampNs != b.timestampNs ? a.timestampNs > b.timestampNs : a.arrival > b.arrival;
+        }
+    };
+}
+
+CInputHub::CInputHub(const InputHubConfig& config)
+    : m_config(config),
+    m_windowNs(std::chrono::duration_cast<std::chrono::nanoseconds>(config.reorderWindow).count()),
+    m_queue(config.queueCapacity),
+    m_running(false),
+    m_consumerWaiting(false),
+    m_dropped(0),
+    m_inOrderHead(0),
+    m_arrivals(0),
+    m_maxSeenNs(INT64_MIN),
+    m_lastDeliveredNs(INT64_MIN),
+    m_received(0),
+    m_delivered(0),
+    m_reordered(0),
+    m_late(0),
+    m_maxPending(0)
+{
+    m_inOrder.reserve(m_queue.Capacity());
+    m_heap.reserve(256);
+    m_out.reserve(m_queue.Capacity());
+}
+
+CInputHub::~CInputHub()
+{
+    Stop();
+}
+
+void CInputHub::SetHandler(InputBatchHandler handler)
+{
+    m_handler = handler;
+}
+
+void CInputHub::Start(void)
+{
+    if (m_running.exchange(true))
+        return;
+    m_thread = std::thread(&CInputHub::ConsumeLoop, this);
+}
+
+void CInputHub::Stop(void)
+{
+    if (!m_running.exchange(false))
+        return;
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        m_wake.notify_one();
+    }
+    if (m_thread.joinable())
+        m_thread.join();
+}
+
+bool CInputHub::IsRunning(void) const
+{
+    return m_running.load();
+}
+
+bool CInputHub::Post(std::span<const InputEvent> events)
+{
+    if (events.empty())
+        return true;
+
+    if (!m_queue.TryPushBatch(events))
+    {
+        m_dropped.fetch_add(events.size(), std::memory_order_relaxed);
+        return false;
+    }
+
+    // Tuketici uyuyorsa uyandir; kuyruk kontrolu ile m_consumerWaiting arasindaki Dekker sirasi icin fence
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_consumerWaiting.load(std::memory_order_relaxed))
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        m_wake.notify_one();
+    }
+    return true;
+}
+
+InputBatchHandler CInputHub::MakeProducer(void)
+{
+    return [this](std::span<const InputEvent> events) { Post(events); };
+}
+
+void CInputHub::ConsumeLoop(void)
+{
+    JL_TRACE_THREAD("CInputHub");
+
+    while (m_running)
+    {
+        Drain();
+        const int64_t nowNs = CLoopPacer::NowNs();
+        Release(nowNs - m_windowNs, nowNs);
+        WaitForWork(nowNs);
+    }
+
+    // Kapanista pencere beklenmez
+    Drain();
+    Release(INT64_MAX, CLoopPacer::NowNs());
+}
+
+void CInputHub::Drain(void)
+{
+    JL_TRACE_SCOPE("HubDrain");
+
+    InputEvent evt;
+    uint64_t received = 0;
+    while (m_queue.TryPop(evt))
+    {
+        received++;
+        const Pending pending{ evt.timestampNs, m_arrivals++, evt };
+        if (evt.timestampNs >= m_maxSeenNs)
+        {
+            m_maxSeenNs = evt.timestampNs;
+            m_inOrder.push_back(pending);
+            continue;
+        }
+
+        if (evt.timestampNs < m_lastDeliveredNs)
+            Bump(m_late);
+        else
+            Bump(m_reordered);
+        m_heap.push_back(pending);
+        std::push_heap(m_heap.begin(), m_heap.end(), LaterFirst());
+    }
+
+    if (received)
+        Bump(m_received, received);
+
+    const size_t pendingCount = m_inOrder.size() - m_inOrderHead + m_heap.size();
+    if (pendingCount > m_maxPending.load(std::memory_order_relaxed))
+        m_maxPending.store(pendingCount, std::memory_order_relaxed);
+}
+
+const CInputHub::Pending* CInputHub::Oldest(bool& fromHeap) const
+{
+    const Pending* fifo = m_inOrderHead < m_inOrder.size() ? &m_inOrder[m_inOrderHead] : nullptr;
+    const Pending* heap = m_heap.empty() ? nullptr : &m_heap.front();
+    fromHeap = heap && (!fifo || LaterFirst()(*fifo, *heap));
+    return fromHeap ? heap : fifo;
+}
+
+void CInputHub::Release(int64_t watermarkNs, int64_t nowNs)
+{
+    m_out.clear();
+    bool fromHeap = false;
+    for (const Pending* oldest = Oldest(fromHeap); oldest && oldest->timestampNs <= watermarkNs; oldest = Oldest(fromHeap))
+    {
+        const InputEvent& evt = oldest->event;
+        const int64_t lag = nowNs - evt.timestampNs;
+        m_deliveryLag.Record(lag > 0 ? static_cast<uint64_t>(lag) : 0);
+        if (evt.timestampNs > m_lastDeliveredNs)
+            m_lastDeliveredNs = evt.timestampNs;
+        m_out.push_back(evt);
+
+        if (fromHeap)
+        {
+            std::pop_heap(m_heap.begin(), m_heap.end(), LaterFirst());
+            m_heap.pop_back();
+        }
+        else
+        {
+            m_inOrderHead++;
+        }
+    }
+
+    // FIFO bosaldiysa basa don, yarisindan fazlasi tuketildiyse sikistir
+    if (m_inOrderHead == m_inOrder.size())
+    {
+        m_inOrder.clear();
+        m_inOrderHead = 0;
+    }
+    else if (m_inOrderHead > m_inOrder.size() / 2)
+    {
+        m_inOrder.erase(m_inOrder.begin(), m_inOrder.begin() + static_cast<std::ptrdiff_t>(m_inOrderHead));
+        m_inOrderHead = 0;
+    }
+
+    if (m_out.empty())
+        return;
+
+    Bump(m_delivered, m_out.size());
+    if (m_handler)
+    {
+        JL_TRACE_SCOPE("HubHandler");
+        m_handler(std::span<const InputEvent>(m_out.data(), m_out.size()));
+    }
+}
+
+// Yeni olay, en eski bekleyen olayin teslim zamani veya idleWait; hangisi once gelirse
+void CInputHub::WaitForWork(int64_t nowNs)
+{
+    int64_t waitNs = std::chrono::duration_cast<std::chrono::nanoseconds>(m_config.idleWait).count();
+    bool fromHeap = false;
+    if (const Pending* oldest = Oldest(fromHeap))
+        waitNs = std::min(waitNs, oldest->timestampNs + m_windowNs - nowNs);
+    if (waitNs <= 0)
+        return;
+
+    std::unique_lock<std::mutex> lock(m_wakeMutex);
+    m_consumerWaiting.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_queue.Size() == 0 && m_running)
+        m_wake.wait_for(lock, std::chrono::nanoseconds(waitNs));
+    m_consumerWaiting.store(false, std::memory_order_relaxed);
+}
+
+InputHubStats CInputHub::GetStats(void) const
+{
+    InputHubStats stats;
+    stats.posted = m_received.load(std::memory_order_relaxed) + m_queue.Size();
+    stats.dropped = m_dropped.load(std::memory_order_relaxed);
+    stats.delivered = m_delivered.load(std::memory_order_relaxed);
+    stats.reordered = m_reordered.load(std::memory_order_relaxed);
+    stats.late = m_late.load(std::memory_order_relaxed);
+    stats.maxPending = m_maxPending.load(std::memory_order_relaxed);
+    m_deliveryLag.Read(stats.deliveryLag, 1.0);
+    return stats;
+}
+
+void InputHubStats::Print(std::ostream& os) const
+{
+    os << "[InputHub] posted : " << posted << "  delivered : " << delivered << "  dropped : " << dropped
+       << "  reordered : " << reordered << "  late : " << late << "  maxPending : " << maxPending << "\n";
+    os << std::fixed << std::setprecision(1)
+       << "  delivery lag  p50 : " << deliveryLag.Percentile(0.50) / 1000.0
+       << "  p99 : " << deliveryLag.Percentile(0.99) / 1000.0
+       << "  max : " << deliveryLag.maxNs / 1000.0 << " us\n";
+}
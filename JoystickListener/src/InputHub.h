@@ -0,0 +1,118 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include "InputEvent.h"
+#include "ListenerMetrics.h"
+#include "MpscQueue.h"
+
+struct InputHubConfig
+{
+    size_t queueCapacity = 1 << 16;
+    // Olaylar zaman damgasindan bu kadar sonra teslim edilir; ureticiler arasi en buyuk
+    // gecikmeden (poll periyodu + handler suresi) buyuk secilmelidir.
+    std::chrono::microseconds reorderWindow = std::chrono::microseconds(2000);
+    std::chrono::microseconds idleWait = std::chrono::microseconds(5000);
+};
+
+struct InputHubStats
+{
+    uint64_t posted = 0;            // tuketicinin aldigi + kuyrukta bekleyen; anlik goruntu
+    uint64_t dropped = 0;           // kuyruk dolu
+    uint64_t delivered = 0;
+    uint64_t reordered = 0;         // daha yeni bir olaydan sonra gelip pencere icinde siraya konan
+    uint64_t late = 0;              // pencere disinda geldi, sirasiz teslim edildi
+    size_t   maxPending = 0;
+    HistogramSnapshot deliveryLag;  // zaman damgasi -> teslim
+
+    void Print(std::ostream& os) const;
+};
+
+// Birden fazla listener'in olaylarini tek, zaman damgasina gore sirali akisa birlestirir.
+// Ureticiler (listener thread'leri) kilitsiz MPSC kuyruga batch olarak yazar; tek tuketici
+// thread olaylari reorderWindow kadar tutar ve damgasi pencereyi gecenleri sirayla handler'a
+// verir. Sirayla gelenler bir FIFO'ya (O(1)), daha yeni bir olaydan sonra gelenler min-heap'e
+// girer; teslimde ikisi birlestirilir. Esit damgalarda gelis sirasi korunur.
+class CInputHub
+{
+public:
+    explicit CInputHub(const InputHubConfig& config = InputHubConfig());
+    ~CInputHub();
+
+    CInputHub(const CInputHub&) = delete;
+    CInputHub& operator=(const CInputHub&) = delete;
+
+    // Tuketici thread'inde cagrilir; Start'tan once verilmeli.
+    void SetHandler(InputBatchHandler handler);
+
+    void Start(void);
+    // Bekleyen tum olaylar teslim edildikten sonra doner.
+    void Stop(void);
+    bool IsRunning(void) const;
+
+    // Herhangi bir thread'den; kuyruk doluysa batch dusurulur ve false doner.
+    bool Post(std::span<const InputEvent> events);
+
+    // listener.SetBatchHandler(hub.MakeProducer())
+    InputBatchHandler MakeProducer(void);
+
+    InputHubStats GetStats(void) const;
+
+private:
+    struct Pending
+    {
+        int64_t    timestampNs;
+        uint64_t   arrival;
+        InputEvent event;
+    };
+
+    void ConsumeLoop(void);
+    void Drain(void);
+    void Release(int64_t watermarkNs, int64_t nowNs);
+    const Pending* Oldest(bool& fromHeap) const;
+    void WaitForWork(int64_t nowNs);
+
+    static void Bump(std::atomic<uint64_t>& counter, uint64_t n = 1)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+    }
+
+    InputHubConfig m_config;
+    int64_t m_windowNs;
+    CMpscQueue<InputEvent> m_queue;
+    InputBatchHandler m_handler;
+
+    std::thread m_thread;
+    std::atomic<bool> m_running;
+
+    std::mutex m_wakeMutex;
+    std::condition_variable m_wake;
+    std::atomic<bool> m_consumerWaiting;
+
+    // Ureticiler; yalnizca kuyruk doluyken yazilir. Basarili Post kuyruk CAS'i disinda ortak
+    // sayaca dokunmaz, posted tuketici tarafinda sayilir.
+    alignas(64) std::atomic<uint64_t> m_dropped;
+
+    // Tuketici thread'ine ait
+    alignas(64) std::vector<Pending> m_inOrder;     // m_inOrderHead'den itibaren damgaya gore sirali
+    size_t m_inOrderHead;
+    std::vector<Pending> m_heap;
+    std::vector<InputEvent> m_out;
+    uint64_t m_arrivals;
+    int64_t  m_maxSeenNs;
+    int64_t  m_lastDeliveredNs;
+    std::atomic<uint64_t> m_received;
+    std::atomic<uint64_t> m_delivered;
+    std::atomic<uint64_t> m_reordered;
+    std::atomic<uint64_t> m_late;
+    std::atomic<size_t>   m_maxPending;
+    CLatencyHistogram m_deliveryLag;
+};
@@ -0,0 +1,242 @@
+#include "InputScheduler.h"
+#include "LoopPacer.h"
+#include "TraceRecorder.h"
+
+#include <iostream>
+#include <exception>
+#include <limits>
+
+void InputTask::promise_type::unhandled_exception() noexcept
+{
+    try
+    {
+        throw;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "[CInputScheduler] coroutine exception: " << e.what() << "\n";
+    }
+    catch (...)
+    {
+        std::cerr << "[CInputScheduler] coroutine exception\n";
+    }
+}
+
+bool CInputScheduler::EventAwaiter::await_ready(void) noexcept
+{
+    if (m_kind == Kind::Invalid)
+        return true;
+    if (m_kind != Kind::AxisBeyond)
+        return false;
+
+    double value = 0.0;
+    if (!m_scheduler.IsAxisBeyond(m_deviceId, m_code, m_threshold, value))
+        return false;
+
+    m_event = InputEvent::Make(CLoopPacer::NowNs(), m_deviceId, InputEventKind::Axis, m_code, static_cast<float>(value));
+    return true;
+}
+
+void CInputScheduler::EventAwaiter::await_suspend(std::coroutine_handle<> handle)
+{
+    m_scheduler.Suspend(*this, handle);
+}
+
+CInputScheduler::CInputScheduler()
+    : m_suspended(0), m_tickCount(0)
+{
+}
+
+CInputScheduler::~CInputScheduler()
+{
+    // Askidaki coroutine'lerin tek sahibi bekleme listeleridir
+    for (auto& device : m_devices)
+    {
+        for (auto& entry : device.second.buttonEdge)
+            for (Waiter& w : entry.second)
+                w.handle.destroy();
+        for (int a = 0; a < AxisSlots; ++a)
+        {
+            for (auto& entry : device.second.axisAbove[a])
+                entry.second.handle.destroy();
+            for (auto& entry : device.second.axisBelow[a])
+                entry.second.handle.destroy();
+        }
+    }
+    for (Waiter& w : m_tickWaiters)
+        w.handle.destroy();
+}
+
+CInputScheduler::EventAwaiter CInputScheduler::NextButtonEdge(uint8_t deviceId, int buttonId)
+{
+    return EventAwaiter(*this, EventAwaiter::Kind::ButtonEdge, deviceId, static_cast<uint16_t>(buttonId), 0.0);
+}
+
+CInputScheduler::EventAwaiter CInputScheduler::AxisBeyond(uint8_t deviceId, int axis, double threshold)
+{
+    if (axis < 0 || axis >= AxisSlots)
+    {
+        std::cerr << "[CInputScheduler] AxisBeyond: invalid axis code " << axis << "\n";
+        EventAwaiter awaiter(*this, EventAwaiter::Kind::Invalid, deviceId, static_cast<uint16_t>(axis), threshold);
+        awaiter.m_event = InputEvent::Make(CLoopPacer::NowNs(), deviceId, InputEventKind::Axis,
+            static_cast<uint16_t>(axis), std::numeric_limits<float>::quiet_NaN());
+        return awaiter;
+    }
+    return EventAwaiter(*this, EventAwaiter::Kind::AxisBeyond, deviceId, static_cast<uint16_t>(axis), threshold);
+}
+
+CInputScheduler::EventAwaiter CInputScheduler::NextTick(void)
+{
+    return EventAwaiter(*this, EventAwaiter::Kind::Tick, 0, 0, 0.0);
+}
+
+void CInputScheduler::Suspend(EventAwaiter& awaiter, std::coroutine_handle<> handle)
+{
+    Waiter waiter{ handle, &awaiter };
+    ++m_suspended;
+
+    switch (awaiter.m_kind)
+    {
+    case EventAwaiter::Kind::ButtonEdge:
+        m_devices[awaiter.m_deviceId].buttonEdge[awaiter.m_code].push_back(waiter);
+        break;
+
+    case EventAwaiter::Kind::AxisBeyond:
+    {
+        // Kod AxisBeyond'da dogrulandi
+        DeviceWaiters& device = m_devices[awaiter.m_deviceId];
+        if (awaiter.m_threshold >= 0.0)
+            device.axisAbove[awaiter.m_code].emplace(awaiter.m_threshold, waiter);
+        else
+            device.axisBelow[awaiter.m_code].emplace(awaiter.m_threshold, waiter);
+        break;
+    }
+
+    case EventAwaiter::Kind::Tick:
+        m_tickWaiters.push_back(waiter);
+        break;
+
+    case EventAwaiter::Kind::Invalid:
+        // await_ready true doner, askiya alinmaz
+        break;
+    }
+}
+
+bool CInputScheduler::IsAxisBeyond(uint8_t deviceId, uint16_t axis, double threshold, double& value)
+{
+    auto it = m_devices.find(deviceId);
+    if (it == m_devices.end() || axis >= AxisSlots || !it->second.axisKnown[axis])
+        return false;
+
+    value = it->second.axisValue[axis];
+    return threshold >= 0.0 ? value >= threshold : value <= threshold;
+}
+
+void CInputScheduler::Post(std::span<const InputEvent> events)
+{
+    std::lock_guard<std::mutex> lock(m_inboxMutex);
+    for (const InputEvent& evt : events)
+    {
+        if (evt.kind == InputEventKind::ButtonHeld || evt.kind == InputEventKind::KeyHold)
+            continue;
+        m_inbox.push_back(evt);
+    }
+}
+
+void CInputScheduler::Tick(void)
+{
+    JL_TRACE_SCOPE("CInputScheduler::Tick");
+
+    ++m_tickCount;
+
+    {
+        std::lock_guard<std::mutex> lock(m_inboxMutex);
+        m_processing.swap(m_inbox);
+    }
+
+    for (const InputEvent& evt : m_processing)
+        Dispatch(evt);
+    m_processing.clear();
+
+    if (!m_tickWaiters.empty())
+    {
+        m_ready.swap(m_tickWaiters);
+        Resume(m_ready, InputEvent::Make(CLoopPacer::NowNs(), 0, InputEventKind::Axis, 0, 0.0f));
+    }
+}
+
+void CInputScheduler::Dispatch(const InputEvent& evt)
+{
+    auto deviceIt = m_devices.find(evt.deviceId);
+
+    if (evt.kind == InputEventKind::Axis)
+    {
+        DeviceWaiters& device = deviceIt != m_devices.end() ? deviceIt->second : m_devices[evt.deviceId];
+        if (evt.code >= AxisSlots)
+            return;
+
+        const double value = evt.value;
+        device.axisValue[evt.code] = value;
+        device.axisKnown[evt.code] = true;
+
+        // Esik sirali; sadece asilan esikler dolasilir. Hazir listesi uye tampondan takasla alinir
+        // (heap ayirmasi yok) ve devam ettirme bitince kapasitesiyle geri konur.
+        std::vector<Waiter> ready;
+        ready.swap(m_dispatchReady);
+        auto& above = device.axisAbove[evt.code];
+        auto aboveEnd = above.upper_bound(value);
+        for (auto it = above.begin(); it != aboveEnd; ++it)
+            ready.push_back(it->second);
+        above.erase(above.begin(), aboveEnd);
+
+        auto& below = device.axisBelow[evt.code];
+        auto belowBegin = below.lower_bound(value);
+        for (auto it = belowBegin; it != below.end(); ++it)
+            ready.push_back(it->second);
+        below.erase(belowBegin, below.end());
+
+        Resume(ready, evt);
+        m_dispatchReady.swap(ready);
+        return;
+    }
+
+    if (evt.kind != InputEventKind::ButtonDown && evt.kind != InputEventKind::ButtonUp)
+        return;
+    if (deviceIt == m_devices.end())
+        return;
+
+    // Devam eden coroutine ayni listeye yeniden kaydolabilir; once listeyi al
+    std::vector<Waiter> ready;
+    ready.swap(m_dispatchReady);
+    for (uint16_t code : { evt.code, static_cast<uint16_t>(0) })
+    {
+        auto it = deviceIt->second.buttonEdge.find(code);
+        if (it == deviceIt->second.buttonEdge.end() || it->second.empty())
+            continue;
+        ready.insert(ready.end(), it->second.begin(), it->second.end());
+        it->second.clear();
+    }
+    Resume(ready, evt);
+    m_dispatchReady.swap(ready);
+}
+
+void CInputScheduler::Resume(std::vector<Waiter>& ready, const InputEvent& evt)
+{
+    for (Waiter& w : ready)
+    {
+        w.awaiter->m_event = evt;
+        --m_suspended;
+        w.handle.resume();
+    }
+    ready.clear();
+}
+
+size_t CInputScheduler::GetSuspendedCount(void) const
+{
+    return m_suspended;
+}
+
+uint64_t CInputScheduler::GetTickIndex(void) const
+{
+    return m_tickCount;
+}
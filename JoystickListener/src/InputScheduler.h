@@ -0,0 +1,120 @@
+#pragma once
+
+#include <coroutine>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "InputEvent.h"
+#include "JoystickState.h"
+
+// Fire-and-forget coroutine tipi. Cagrildigi anda ilk co_await'e kadar calisir,
+// sonra CInputScheduler tarafindan sim thread'inde devam ettirilir.
+struct InputTask
+{
+    struct promise_type
+    {
+        InputTask get_return_object() noexcept      { return {};    }
+        std::suspend_never initial_suspend() noexcept { return {};  }
+        std::suspend_never final_suspend() noexcept   { return {};  }
+        void return_void() noexcept                 {}
+        void unhandled_exception() noexcept;
+    };
+};
+
+// Tek thread'li girdi zamanlayicisi. Listener'lar olaylari Post() ile birakir
+// (herhangi bir thread), sim dongusu Tick() ile bunlari isler ve bekleyen
+// coroutine'leri ayni thread'de devam ettirir. Bekleyenler olay tipine, cihaza
+// ve buton/eksene gore indekslenir; bir olay sadece ilgili bekleyenlere bakar,
+// askidaki coroutine'ler icin thread veya her poll'da tarama yoktur.
+class CInputScheduler
+{
+public:
+    class EventAwaiter
+    {
+    public:
+        bool await_ready(void) noexcept;
+        void await_suspend(std::coroutine_handle<> handle);
+        InputEvent await_resume(void) const noexcept   { return m_event; }
+
+    private:
+        friend class CInputScheduler;
+
+        enum class Kind { ButtonEdge, AxisBeyond, Tick, Invalid };
+
+        EventAwaiter(CInputScheduler& scheduler, Kind kind, uint8_t deviceId, uint16_t code, double threshold)
+            : m_scheduler(scheduler), m_kind(kind), m_deviceId(deviceId), m_code(code), m_threshold(threshold), m_event()
+        {
+        }
+
+        CInputScheduler& m_scheduler;
+        Kind       m_kind;
+        uint8_t    m_deviceId;
+        uint16_t   m_code;
+        double     m_threshold;
+        InputEvent m_event;
+    };
+
+    CInputScheduler();
+    ~CInputScheduler();
+
+    CInputScheduler(const CInputScheduler&) = delete;
+    CInputScheduler& operator=(const CInputScheduler&) = delete;
+
+    // buttonId 0 ise cihazin herhangi bir butonu
+    EventAwaiter NextButtonEdge(uint8_t deviceId, int buttonId = 0);
+
+    // threshold >= 0: deger >= threshold, threshold < 0: deger <= threshold.
+    // Eksen zaten esigin otesindeyse beklemeden doner. axis 0..MaxAxes-1 veya InputEvent::PovCode;
+    // disindaki kodlar beklemeden hata olarak doner (olayin value'su NaN).
+    EventAwaiter AxisBeyond(uint8_t deviceId, int axis, double threshold);
+
+    // Bir sonraki Tick(); donen olayda sadece timestampNs anlamlidir.
+    EventAwaiter NextTick(void);
+
+    // Listener thread'lerinden; Held/Hold olaylari alinmaz.
+    void Post(std::span<const InputEvent> events);
+
+    // Sim thread'inden, her tick'te bir kez.
+    void Tick(void);
+
+    size_t GetSuspendedCount(void) const;
+    uint64_t GetTickIndex(void) const;
+
+private:
+    struct Waiter
+    {
+        std::coroutine_handle<> handle;
+        EventAwaiter* awaiter;
+    };
+
+    static const int AxisSlots = JoystickState::MaxAxes + 1;   // eksenler + InputEvent::PovCode
+
+    struct DeviceWaiters
+    {
+        std::unordered_map<uint16_t, std::vector<Waiter>> buttonEdge;   // 0: herhangi bir buton
+        std::multimap<double, Waiter> axisAbove[AxisSlots];
+        std::multimap<double, Waiter> axisBelow[AxisSlots];
+        double axisValue[AxisSlots] = {};
+        bool   axisKnown[AxisSlots] = {};
+    };
+
+    void Suspend(EventAwaiter& awaiter, std::coroutine_handle<> handle);
+    bool IsAxisBeyond(uint8_t deviceId, uint16_t axis, double threshold, double& value);
+    void Dispatch(const InputEvent& evt);
+    void Resume(std::vector<Waiter>& ready, const InputEvent& evt);
+
+    std::mutex m_inboxMutex;
+    std::vector<InputEvent> m_inbox;
+    std::vector<InputEvent> m_processing;
+
+    std::map<uint8_t, DeviceWaiters> m_devices;
+    std::vector<Waiter> m_tickWaiters;
+    std::vector<Waiter> m_ready;        // NextTick icin takas tamponu
+    std::vector<Waiter> m_dispatchReady;    // Dispatch'in hazir listesi; kapasitesi olaylar arasinda korunur
+    size_t m_suspended;
+    uint64_t m_tickCount;
+};
@@ -0,0 +1,116 @@
+#include "InputSession.h"
+
+#include <fstream>
+#include <cstring>
+#include <algorithm>
+
+static const char SessionMagic[4] = { 'J', 'L', 'S', 'S' };
+
+CInputSession::CInputSession()
+    : m_deviceKind(InputDeviceKind::DirectInput)
+{
+}
+
+bool CInputSession::Load(const std::string& filename)
+{
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    if (!file.is_open())
+        return false;
+
+    const uint64_t fileSize = static_cast<uint64_t>(file.tellg());
+    file.seekg(0);
+
+    char magic[4];
+    uint32_t version = 0, kind = 0, sampleSize = 0;
+    uint64_t count = 0;
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char*>(&version), sizeof(version));
+    file.read(reinterpret_cast<char*>(&kind), sizeof(kind));
+    file.read(reinterpret_cast<char*>(&sampleSize), sizeof(sampleSize));
+    file.read(reinterpret_cast<char*>(&count), sizeof(count));
+
+    if (!file || std::memcmp(magic, SessionMagic, sizeof(magic)) != 0 ||
+        version != Version || sampleSize != sizeof(InputSample))
+        return false;
+
+    // ParseHeader gibi: sayi dosyaya sigan orneklerle sinirlanir, bozuk baslik buyuk ayirma yaptirmaz
+    count = std::min<uint64_t>(count, (fileSize - HeaderSize) / sizeof(InputSample));
+
+    m_deviceKind = static_cast<InputDeviceKind>(kind);
+    m_samples.resize(static_cast<size_t>(count));
+    if (count)
+    {
+        const std::streamsize bytes = static_cast<std::streamsize>(count * sizeof(InputSample));
+        file.read(reinterpret_cast<char*>(m_samples.data()), bytes);
+        if (!file || file.gcount() != bytes)
+        {
+            m_samples.clear();
+            return false;
+        }
+    }
+    return true;
+}
+
+bool CInputSession::ParseHeader(const uint8_t* data, size_t size, InputDeviceKind& kind, uint64_t& sampleCount)
+{
+    if (size < HeaderSize || std::memcmp(data, SessionMagic, sizeof(SessionMagic)) != 0)
+        return false;
+
+    uint32_t version = 0, deviceKind = 0, sampleSize = 0;
+    uint64_t count = 0;
+    std::memcpy(&version, data + 4, sizeof(version));
+    std::memcpy(&deviceKind, data + 8, sizeof(deviceKind));
+    std::memcpy(&sampleSize, data + 12, sizeof(sampleSize));
+    std::memcpy(&count, data + 16, sizeof(count));
+    if (version != Version || sampleSize != sizeof(InputSample))
+        return false;
+
+    kind = static_cast<InputDeviceKind>(deviceKind);
+    sampleCount = std::min<uint64_t>(count, (size - HeaderSize) / sizeof(InputSample));
+    return true;
+}
+
+bool CInputSession::Save(const std::string& filename) const
+{
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+        return false;
+
+    const uint32_t version = Version;
+    const uint32_t kind = static_cast<uint32_t>(m_deviceKind);
+    const uint32_t sampleSize = sizeof(InputSample);
+    const uint64_t count = m_samples.size();
+
+    file.write(SessionMagic, sizeof(SessionMagic));
+    file.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    file.write(reinterpret_cast<const char*>(&kind), sizeof(kind));
+    file.write(reinterpret_cast<const char*>(&sampleSize), sizeof(sampleSize));
+    file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    if (count)
+        file.write(reinterpret_cast<const char*>(m_samples.data()), static_cast<std::streamsize>(count * sizeof(InputSample)));
+    return static_cast<bool>(file);
+}
+
+CInputSessionRecorder::CInputSessionRecorder(InputDeviceKind kind, size_t reserveSamples)
+{
+    m_session.SetDeviceKind(kind);
+    m_session.GetSamples().reserve(reserveSamples);
+}
+
+void CInputSessionRecorder::Record(const InputSample& sample)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_session.GetSamples().push_back(sample);
+}
+
+bool CInputSessionRecorder::Save(const std::string& filename)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_session.Save(filename);
+}
+
+size_t CInputSessionRecorder::GetSampleCount(void)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_session.GetSamples().size();
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <mutex>
+
+enum class InputDeviceKind : uint32_t
+{
+    WinMM = 0,          // CJoystickListener (JOYINFOEX)
+    DirectInput = 1     // CJoystickListenerDI (DIJOYSTATE2)
+};
+
+// Cihazdan okunan ham ornek. Eksen sirasi DirectInput icin
+// lX, lY, lZ, lRx, lRy, lRz, rglSlider[0], rglSlider[1];
+// WinMM icin dwXpos, dwYpos, dwZpos, dwRpos, dwUpos, dwVpos.
+struct InputSample
+{
+    int64_t  timestampNs;
+    int32_t  axes[8];
+    uint32_t pov[4];
+    uint32_t buttons[4];
+
+    bool IsButtonPressed(int index) const
+    {
+        return (buttons[index >> 5] & (1u << (index & 31))) != 0;
+    }
+};
+
+// Kayitli oturum dosyasi:
+//   "JLSS" | uint32 version | uint32 deviceKind | uint32 sampleSize | uint64 sampleCount | samples
+// Sabit boyutlu kayitlar dosyadan dogrudan (mmap dahil) okunabilir.
+class CInputSession
+{
+public:
+    static const uint32_t Version = 1;
+    static const size_t HeaderSize = 24;
+
+    CInputSession();
+
+    // Eslenmis dosya icin: basligi dogrular; ornekler data + HeaderSize'dan baslar.
+    // sampleCount dosya boyuna sigmayan kuyruk orneklerini icermez.
+    static bool ParseHeader(const uint8_t* data, size_t size, InputDeviceKind& kind, uint64_t& sampleCount);
+
+    bool Load(const std::string& filename);
+    bool Save(const std::string& filename) const;
+
+    InputDeviceKind GetDeviceKind(void) const           { return m_deviceKind;  }
+    void SetDeviceKind(InputDeviceKind kind)            { m_deviceKind = kind;  }
+
+    const std::vector<InputSample>& GetSamples(void) const { return m_samples;  }
+    std::vector<InputSample>& GetSamples(void)             { return m_samples;  }
+
+private:
+    InputDeviceKind m_deviceKind;
+    std::vector<InputSample> m_samples;
+};
+
+// Listener'in ham ornek handler'ina baglanip oturum kaydeder.
+class CInputSessionRecorder
+{
+public:
+    explicit CInputSessionRecorder(InputDeviceKind kind, size_t reserveSamples = 1 << 16);
+
+    void Record(const InputSample& sample);
+    bool Save(const std::string& filename);
+    size_t GetSampleCount(void);
+
+private:
+    std::mutex m_mutex;
+    CInputSession m_session;
+};
@@ -16,67 +16,98 @@
 #include <algorithm>
 
 #include "ILogger.h"
+#include "JoystickListenerCore.h"
 
-class CJoystickListener
+// joyGetPosEx (WinMM) ile okuma.
+class CWinMMJoystickBackend
 {
-    const bool UseThrottleButtonAsReversed = true;
 public:
-    using ButtonHandler = std::function<void(int buttonId, bool pressed)>;
-    using ButtonHeldHandler = std::function<void(int buttonId)>;
-    using AxisHandler = std::function<void(double x, double y, double z, double pov, std::string povDir)>;
+    using State = JOYINFOEX;
+    static constexpr const char* Name = "CJoystickListener";
+    static constexpr const char* ThreadName = "JoyListener";
 
-    ~CJoystickListener();
-     CJoystickListener(UINT joystickId = 0);
+    explicit CWinMMJoystickBackend(UINT joystickId);
 
-    bool Init(void);
-    void Reset(void);
-    void Start(void);
-    void Stop(void);
-    void CalibrateCenter(void);
+    bool Init(std::ostream* log, const CLogLevels& levels);
+    bool Read(JOYINFOEX& state, CListenerMetrics& metrics);
+    bool ReadCenter(JOYINFOEX& prev);
 
-    void StartListening(void);
-    void StopListening(void);
+    UINT GetJoystickId(void) const { return m_joystickId; }
 
-    bool IsRunning(void) const;
-    bool IsStopped(void) const;
-    bool IsInit(void) const;
-
-    void SetAxisHandler(AxisHandler handler);
-    void SetButtonHandler(ButtonHandler handler);
-    void SetButtonHeldHandler(ButtonHeldHandler handler);
-
-    void SetLogger(std::shared_ptr<std::ostream> logger);
-    void SetSilentMode(bool silentAxis = true, bool silentButton = true, bool silentButtonHeld = true);
-
-    void  SetExternalObject(void* pObject);
-    void* GetExternalObject(void);
-
-    void SetNormalize(bool normalize);
-    bool GetNormalize(void);
+    // WinMMAxisLayout::VectorAxes sirasiyla (JOYCAPS); Init'ten once tum bitler 1
+    uint32_t GetAxisPresence(void) const { return m_axisPresence; }
 
 private:
-    void ListenLoop(void);
-
     UINT m_joystickId;
-    std::thread m_thread;
-    std::atomic<bool> m_running;
-    std::atomic<bool> m_initialized;
-    std::atomic<bool> m_silentAxis;
-    std::atomic<bool> m_silentButton;
-    std::atomic<bool> m_silentButtonHeld;
-
-    AxisHandler m_axisHandler;
-    ButtonHandler m_buttonHandler;
-    ButtonHeldHandler m_buttonHeldHandler;
-
-    JOYINFOEX m_joyInfoPrev;
+    uint32_t m_axisPresence;
+};
 
-    //std::shared_ptr<ILogger> m_logger;
-    std::shared_ptr<std::ostream> m_logger;
-
-    std::string MapPOV(DWORD pov);
-
-    void* m_pExternalObject;
-
-    std::atomic<bool> m_normalize;
-};
\ No newline at end of file
+// JOYINFOEX: X/Y/Z (Z throttle), 32 buton, tek POV. Eksen vektoru X/Y/Z/R/U/V.
+struct WinMMAxisLayout
+{
+    using State = JOYINFOEX;
+
+    static constexpr int AxisCount = 3;
+    static constexpr int ThrottleAxis = JoystickState::AxisZ;
+    static constexpr int ButtonCount = 32;
+    static constexpr const char* AxisLabels[AxisCount] = { "X", "Y", "Z" };
+
+    static constexpr int VectorAxisCount = 6;
+    static constexpr int PovCount = 1;
+    static constexpr AxisInfo VectorAxes[VectorAxisCount] = {
+        { "X", AxisAspect::Position, AxisRange::Bipolar }, { "Y", AxisAspect::Position, AxisRange::Bipolar },
+        { "Z", AxisAspect::Position, AxisRange::Unipolar }, { "R", AxisAspect::Position, AxisRange::Bipolar },
+        { "U", AxisAspect::Position, AxisRange::Bipolar }, { "V", AxisAspect::Position, AxisRange::Bipolar },
+    };
+
+    // dwXpos..dwVpos ardisik DWORD
+    static void ReadAxisVector(const JOYINFOEX& state, int32_t* axes)
+    {
+        static_assert(sizeof(DWORD) == sizeof(int32_t), "JOYINFOEX axes are 32-bit");
+        memcpy(axes, &state.dwXpos, VectorAxisCount * sizeof(int32_t));
+    }
+
+    static void ReadPovs(const JOYINFOEX& state, uint32_t* povs)   { povs[0] = state.dwPOV; }
+
+    static void Clear(JOYINFOEX& state)
+    {
+        ZeroMemory(&state, sizeof(state));
+        state.dwSize = sizeof(JOYINFOEX);
+        state.dwFlags = JOY_RETURNALL;
+        state.dwPOV = JOY_POVCENTERED;
+    }
+
+    static void ReadAxes(const JOYINFOEX& state, int32_t (&axes)[AxisCount])
+    {
+        axes[0] = static_cast<int32_t>(state.dwXpos);
+        axes[1] = static_cast<int32_t>(state.dwYpos);
+        axes[2] = static_cast<int32_t>(state.dwZpos);
+    }
+
+    static bool IsPressed(const JOYINFOEX& state, int i)                { return (state.dwButtons & (1u << i)) != 0; }
+    static void PackButtons(const JOYINFOEX& state, uint32_t* words)    { words[0] = state.dwButtons; }
+    static uint32_t Pov(const JOYINFOEX& state)                         { return state.dwPOV; }
+    static double CorrectedPov(uint32_t pov)                            { return pov; }
+
+    static bool Changed(const JOYINFOEX& prev, const JOYINFOEX& curr)
+    {
+        return prev.dwButtons != curr.dwButtons ||
+            prev.dwXpos != curr.dwXpos ||
+            prev.dwYpos != curr.dwYpos ||
+            prev.dwZpos != curr.dwZpos ||
+            prev.dwPOV != curr.dwPOV;
+    }
+
+    static void ToSample(const JOYINFOEX& joyInfo, int64_t timestampNs, InputSample& sample);
+    static void FromSample(const InputSample& sample, JOYINFOEX& joyInfo);
+};
+
+using CJoystickListenerBase = CJoystickListenerCore<CWinMMJoystickBackend, WinMMAxisLayout, AxisNormalizer<true>, CFunctionDispatch<3>>;
+extern template class CJoystickListenerCore<CWinMMJoystickBackend, WinMMAxisLayout, AxisNormalizer<true>, CFunctionDispatch<3>>;
+
+// WinMM joystick: throttle ters, std::function callback'ler.
+class CJoystickListener : public CJoystickListenerBase
+{
+public:
+    CJoystickListener(UINT joystickId = 0);
+};
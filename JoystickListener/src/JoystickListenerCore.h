@@ -0,0 +1,1064 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "AllocationTracker.h"
+#include "AxisFilter.h"
+#include "AxisPredictor.h"
+#include "AxisVector.h"
+#include "FixedPointAxis.h"
+#include "InputEvent.h"
+#include "InputScheduler.h"
+#include "InputSession.h"
+#include "JoystickState.h"
+#include "ListenerMetrics.h"
+#include "LogLevel.h"
+#include "LogRateLimiter.h"
+#include "LoopPacer.h"
+#include "SyntheticInputSource.h"
+#include "ThreadConfig.h"
+#include "TraceRecorder.h"
+#include "TripleBuffer.h"
+
+// Joystick listener cekirdegi; poll'dan dispatch'e kadar tum yol policy'lerle derleme zamaninda kurulur.
+//
+//   Backend    : cihaz erisimi. using State; static constexpr Name, ThreadName;
+//                bool Init(std::ostream* log, const CLogLevels& levels);
+//                bool Read(State& state, CListenerMetrics& metrics);     // hata sayaclarini kendisi gunceller
+//                bool ReadCenter(State& prev);
+//                uint32_t GetAxisPresence(void) const;                   // VectorAxes sirasiyla
+//   Layout     : State'ten eksen/buton/POV okuma. using State; AxisCount, ThrottleAxis, ButtonCount, AxisLabels;
+//                Clear, ReadAxes, IsPressed, PackButtons, Pov, CorrectedPov, Changed, ToSample, FromSample
+//                Eksen vektoru: VectorAxisCount, PovCount, VectorAxes (AxisInfo), ReadAxisVector, ReadPovs
+//   Normalizer : ham eksen -> handler degeri. Bipolar, Throttle, RawThrottle, ReversesThrottle
+//   Dispatch   : tekil handler'lar (public taban sinif; SetAxisHandler vb. buradan gelir).
+//                WantsButtons/WantsButtonHeld/WantsAxes, OnButton, OnButtonHeld, OnAxes
+//
+// Layout ve Normalizer fonksiyonlari inline oldugu icin eksen sayisi, buton sayisi ve throttle
+// ayarlari sabit olarak yerlesir; CSinkDispatch ile handler cagrilari da dogrudan yapilir.
+
+// Normalize: bipolar eksenler [-1, 1], throttle [0, 1].
+// ReverseThrottle: throttle ileri itildiginde buyusun diye ters cevrilir (normalize ve ham).
+template<bool ReverseThrottle = true>
+struct AxisNormalizer
+{
+    static constexpr bool ReversesThrottle = ReverseThrottle;
+
+    static double Bipolar(int32_t raw)
+    {
+        return std::clamp((static_cast<float>(raw) - 32767.5) / 32767.5, -1.0, 1.0);
+    }
+
+    static double Throttle(int32_t raw)
+    {
+        const double z = std::clamp(static_cast<float>(raw) / 65535.0, 0.0, 1.0);
+        return ReverseThrottle ? (1.0 - z) : z;
+    }
+
+    static double RawThrottle(int32_t raw)
+    {
+        return ReverseThrottle ? (65535.0 - raw) : raw;
+    }
+};
+
+template<int AxisCount>
+struct AxisHandlerOf;
+
+template<>
+struct AxisHandlerOf<3>
+{
+    using Type = std::function<void(double x, double y, double z, double pov, std::string_view povDir)>;
+};
+
+template<>
+struct AxisHandlerOf<4>
+{
+    using Type = std::function<void(double x, double y, double z, double rz, double pov, std::string_view povDir)>;
+};
+
+// Calisma zamaninda degistirilebilen std::function callback'ler.
+template<int AxisCount>
+class CFunctionDispatch
+{
+public:
+    using ButtonHandler = std::function<void(int buttonId, bool pressed)>;
+    using ButtonHeldHandler = std::function<void(int buttonId)>;
+    using AxisHandler = typename AxisHandlerOf<AxisCount>::Type;
+
+    void SetAxisHandler(AxisHandler handler)            { m_axisHandler = handler; }
+    void SetButtonHandler(ButtonHandler handler)        { m_buttonHandler = handler; }
+    void SetButtonHeldHandler(ButtonHeldHandler handler) { m_buttonHeldHandler = handler; }
+
+protected:
+    bool WantsButtons(void) const       { return static_cast<bool>(m_buttonHandler); }
+    bool WantsButtonHeld(void) const    { return static_cast<bool>(m_buttonHeldHandler); }
+    bool WantsAxes(void) const          { return static_cast<bool>(m_axisHandler); }
+
+    void OnButton(int buttonId, bool pressed)   { m_buttonHandler(buttonId, pressed); }
+    void OnButtonHeld(int buttonId)             { m_buttonHeldHandler(buttonId); }
+
+    void OnAxes(const double (&axes)[AxisCount], double pov, std::string_view povDir)
+    {
+        InvokeAxes(axes, pov, povDir, std::make_index_sequence<AxisCount>());
+    }
+
+private:
+    template<size_t... I>
+    void InvokeAxes(const double (&axes)[AxisCount], double pov, std::string_view povDir, std::index_sequence<I...>)
+    {
+        m_axisHandler(axes[I]..., pov, povDir);
+    }
+
+    AxisHandler m_axisHandler;
+    ButtonHandler m_buttonHandler;
+    ButtonHeldHandler m_buttonHeldHandler;
+};
+
+// Handler'lar derleme zamaninda bilinen sink nesnesine dogrudan cagrilir (std::function ve sanal
+// cagri yok). Sink istedigi olaylari static constexpr bool WantsButtons/WantsButtonHeld/WantsAxes ile
+// bildirir ve yalnizca onlarin uyelerini yazar:
+//   void OnButton(int buttonId, bool pressed);
+//   void OnButtonHeld(int buttonId);
+//   void OnAxes(const double (&axes)[AxisCount], double pov, std::string_view povDir);
+template<typename TSink>
+class CSinkDispatch
+{
+public:
+    void   SetSink(TSink* sink)  { m_sink = sink; }
+    TSink* GetSink(void) const   { return m_sink; }
+
+protected:
+    bool WantsButtons(void) const       { return TSink::WantsButtons && m_sink; }
+    bool WantsButtonHeld(void) const    { return TSink::WantsButtonHeld && m_sink; }
+    bool WantsAxes(void) const          { return TSink::WantsAxes && m_sink; }
+
+    void OnButton(int buttonId, bool pressed)
+    {
+        if constexpr (TSink::WantsButtons)
+            m_sink->OnButton(buttonId, pressed);
+    }
+
+    void OnButtonHeld(int buttonId)
+    {
+        if constexpr (TSink::WantsButtonHeld)
+            m_sink->OnButtonHeld(buttonId);
+    }
+
+    template<size_t N>
+    void OnAxes(const double (&axes)[N], double pov, std::string_view povDir)
+    {
+        if constexpr (TSink::WantsAxes)
+            m_sink->OnAxes(axes, pov, povDir);
+    }
+
+private:
+    TSink* m_sink = nullptr;
+};
+
+template<typename Backend, typename Layout, typename Normalizer, typename Dispatch>
+class CJoystickListenerCore : public Dispatch
+{
+    static_assert(std::is_same_v<typename Backend::State, typename Layout::State>, "Backend and Layout must share the device state type");
+
+public:
+    using State = typename Layout::State;
+    using RawSampleHandler = std::function<void(const InputSample& sample)>;
+    using AxisVectorHandler = std::function<void(const AxisVector& vector)>;
+
+    static constexpr int AxisCount = Layout::AxisCount;
+    static constexpr int VectorAxisCount = Layout::VectorAxisCount;
+    static constexpr int ButtonCount = Layout::ButtonCount;
+
+    template<typename... BackendArgs>
+    explicit CJoystickListenerCore(uint8_t deviceId, BackendArgs&&... backendArgs);
+    ~CJoystickListenerCore();
+
+    bool Init(void);
+    void Reset(void);
+    void Start(void);
+    void Stop(void);
+    void CalibrateCenter(void);
+
+    void StartListening(void);
+    void StopListening(void);
+
+    bool IsRunning(void) const;
+    bool IsStopped(void) const;
+    bool IsInit(void) const;
+
+    // Bir poll'daki tum olaylar tek span olarak; tekil handler'lar bunun uzerinden beslenir.
+    void SetBatchHandler(InputBatchHandler handler);
+    void SetDeviceId(uint8_t deviceId);
+    uint8_t GetDeviceId(void) const;
+
+    // co_await ile beklenen olaylar; coroutine'ler scheduler'in Tick()'i cagrildigi thread'de devam eder.
+    // Start'tan once SetScheduler cagrilmalidir; scheduler yoksa NextButtonEdge/AxisBeyond
+    // std::logic_error atar (coroutine icinde InputTask bunu yakalayip loglar).
+    void SetScheduler(CInputScheduler* scheduler);
+    CInputScheduler* GetScheduler(void) const;
+    CInputScheduler::EventAwaiter NextButtonEdge(int buttonId = 0);
+    CInputScheduler::EventAwaiter AxisBeyond(int axis, double threshold);
+
+    void SetLogger(std::shared_ptr<std::ostream> logger);
+    void SetSilentMode(bool silentAxis = true, bool silentButton = true, bool silentButtonHeld = true);
+
+    // Kategori basina seviye (varsayilan Off); JL_LOG_MIN_LEVEL altindaki seviyeler derlenmez.
+    void SetLogLevel(LogCategory category, LogLevel level);
+
+    // Basili buton satirlari: ilk olay ve aralik basina bir ozet (0: her poll)
+    void SetLogRateInterval(std::chrono::milliseconds interval);
+    const CLogRateLimiter& GetLogRateLimiter(void) const;
+
+    void  SetExternalObject(void* pObject);
+    void* GetExternalObject(void);
+
+    void SetNormalize(bool normalize);
+    bool GetNormalize(void);
+
+    // Normalize acikken cikis hassasiyeti; Start'tan once verilir. Q15'te eksenler tamsayi
+    // yoldan gecer, latest state axesQ15'i de doldurur.
+    void SetAxisPrecision(AxisPrecision precision, const FixedAxisConfig& config = FixedAxisConfig());
+    AxisPrecision GetAxisPrecision(void) const;
+
+    // Cihazin tum eksenleri (Layout::VectorAxes sirasiyla) ve tum POV'lari; Start'tan once acilir.
+    // Handler yalnizca bir eksen veya POV degistiginde, listener thread'inden cagrilir.
+    void EnableAxisVector(bool enable);
+    void SetAxisVectorHandler(AxisVectorHandler handler);
+    AxisVector GetLatestAxisVector(void);
+    static const AxisInfo& GetAxisInfo(int index);
+
+    const CListenerMetrics& GetMetrics(void) const;
+    ListenerMetricsSnapshot GetMetricsSnapshot(void) const;
+
+    void SetPollPeriod(std::chrono::microseconds period, std::chrono::microseconds spinWindow = std::chrono::microseconds(0));
+    PacerStats GetPacerStats(void) const;
+
+    void SetThreadConfig(const ThreadConfig& config);
+    ThreadConfigResult GetThreadConfigResult(void) const;
+
+    // Son poll'un tutarli kopyasi; herhangi bir thread'den, listener thread'ini hic bekletmez.
+    JoystickState GetLatestState(void);
+
+    // Eksen filtresi (One Euro + degisim esigi + sicrama reddi); Start'tan once verilir.
+    // Acikken latest state ve eksen olaylari filtrelenmis degerleri tasir.
+    void SetAxisFilter(const AxisFilterConfig& config);
+    AxisFilterStats GetAxisFilterStats(void) const;
+
+    // Latest state yolunda tahmin: listener her ornekte turevleri kestirir,
+    // GetPredictedState() eksenleri queryTimeNs anina (orn. sim tick zamani) tasir.
+    void SetPrediction(const PredictionConfig& config);
+    JoystickState GetPredictedState(int64_t queryTimeNs);
+
+    // Ham ornek kaydi (listener thread'inden cagrilir) ve replay icin tek ornek isleme.
+    void SetRawSampleHandler(RawSampleHandler handler);
+    bool ProcessState(const State& state, int64_t sampleTimeNs);
+    void ResetState(void);
+
+    static void ToSample(const State& state, int64_t timestampNs, InputSample& sample)  { Layout::ToSample(state, timestampNs, sample); }
+    static void FromSample(const InputSample& sample, State& state)                    { Layout::FromSample(sample, state); }
+
+    // Cihaz yerine sentetik kaynaktan oku (stres testi). Init gerektirmez; Start'tan once cagrilir.
+    void SetInputSource(CSyntheticInputSource* source);
+
+    Backend& GetBackend(void);
+
+private:
+    void ListenLoop(void);
+    void DispatchEvents(const double (&axes)[AxisCount], double pov, uint32_t povRaw);
+    void ProcessAxisVector(const State& state, int64_t sampleTimeNs);
+
+    static const char* MapPOV(uint32_t pov);
+    static int FormatAxisLine(char* line, size_t size, const double (&axes)[AxisCount], double pov, std::string_view povDir);
+
+    Backend m_backend;
+
+    std::thread m_thread;
+    std::atomic<bool> m_running;
+    std::atomic<bool> m_initialized;
+    CLogLevels m_logLevels;
+    CLogRateLimiter m_logRate;
+
+    RawSampleHandler m_rawSampleHandler;
+    InputBatchHandler m_batchHandler;
+
+    State m_statePrev;
+
+    std::shared_ptr<std::ostream> m_logger;
+
+    void* m_pExternalObject;
+
+    std::atomic<bool> m_normalize;
+    AxisPrecision m_axisPrecision;
+    CFixedAxisNormalizer m_fixedNormalizer;
+
+    CListenerMetrics m_metrics;
+    CLoopPacer m_pacer;
+
+    ThreadConfig m_threadConfig;
+    ThreadConfigResult m_threadConfigResult;
+
+    CTripleBuffer<JoystickState> m_latestState;
+    uint64_t m_sampleSequence;
+
+    bool m_axisVectorEnabled;
+    AxisVectorHandler m_axisVectorHandler;
+    CAxisVectorProcessor m_axisVectorProcessor;
+    CTripleBuffer<AxisVector> m_latestAxisVector;
+
+    CAxisFilterStage m_axisFilter;
+    CAxisPredictor m_predictor;
+
+    CSyntheticInputSource* m_inputSource;
+    CInputScheduler* m_scheduler;
+
+    uint8_t m_deviceId;
+    std::vector<InputEvent> m_events;
+};
+
+#define JL_LISTENER_CORE_TEMPLATE template<typename Backend, typename Layout, typename Normalizer, typename Dispatch>
+#define JL_LISTENER_CORE CJoystickListenerCore<Backend, Layout, Normalizer, Dispatch>
+
+JL_LISTENER_CORE_TEMPLATE
+template<typename... BackendArgs>
+JL_LISTENER_CORE::CJoystickListenerCore(uint8_t deviceId, BackendArgs&&... backendArgs)
+    : m_backend(std::forward<BackendArgs>(backendArgs)...),
+    m_running(false),
+    m_initialized(false),
+    m_logLevels(LogLevel::Off),
+    m_pExternalObject(nullptr),
+    m_normalize(true),
+    m_axisPrecision(AxisPrecision::Double),
+    m_metrics(Backend::Name),
+    m_pacer(std::chrono::milliseconds(20)),
+    m_sampleSequence(0),
+    m_axisVectorEnabled(false),
+    m_inputSource(nullptr),
+    m_scheduler(nullptr),
+    m_deviceId(deviceId)
+{
+    static_assert(AxisCount <= JoystickState::MaxAxes, "Layout has more axes than JoystickState holds");
+    static_assert(VectorAxisCount <= AxisVector::MaxAxes && Layout::PovCount <= AxisVector::MaxPovs, "Layout axis vector is too large");
+
+    m_threadConfig.name = Backend::ThreadName;
+    m_events.reserve(2 * ButtonCount + AxisCount + 4);
+
+    Layout::Clear(m_statePrev);
+    m_axisVectorProcessor.Configure(Layout::VectorAxes, VectorAxisCount, Layout::PovCount, Normalizer::ReversesThrottle, FixedAxisConfig());
+}
+
+JL_LISTENER_CORE_TEMPLATE
+JL_LISTENER_CORE::~CJoystickListenerCore()
+{
+    // Cihaz (m_backend) thread durduktan sonra birakilir
+    StopListening();
+}
+
+JL_LISTENER_CORE_TEMPLATE
+bool JL_LISTENER_CORE::Init(void)
+{
+    m_initialized = m_backend.Init(m_logger.get(), m_logLevels);
+    m_axisVectorProcessor.SetPresentMask(m_backend.GetAxisPresence());
+    return m_initialized;
+}
+
+JL_LISTENER_CORE_TEMPLATE
+void JL_LISTENER_CORE::Reset(void)
+{
+    Layout::Clear(m_statePrev);
+    if (m_logger)
+        JL_LOG_INFO(m_logLevels, LogCategory::Lifecycle, (*m_logger) << "Joystick state reset.\n");
+}
+
+JL_LISTENER_CORE_TEMPLATE
+void JL_LISTENER_CORE::Start(void)
+{
+    if ((m_initialized || m_inputSource) && !m_running)
+    {
+        m_running = true;
+        m_thread = std::thread(&CJoystickListenerCore::ListenLoop, this);
+        m_threadConfigResult = ApplyThreadConfig(m_thread.native_handle(), m_threadConfig);
+        if (m_logger)
+        {
+            JL_LOG_INFO(m_logLevels, LogCategory::Lifecycle,
+                (*m_logger) << "[" << Backend::Name << "] Listening thread started.\n";
+                (*m_logger) << "[" << Backend::Name << "] Thread : " << m_threadConfigResult.ToString() << "\n");
+        }
+    }
+}
+
+JL_LISTENER_CORE_TEMPLATE
+void JL_LISTENER_CORE::Stop(void)
+{
+    bool wasRunning = m_running.exchange(false);
+    if (m_thread.joinable() && std::this_thread::get_id() != m_thread.get_id())
+    {
+        m_thread.join();
+    }
+    if (wasRunning)
+    {
+        if (m_logger)
+            JL_LOG_INFO(m_logLevels, LogCategory::Lifecycle, (*m_logger) << "[" << Backend::Name << "] Listening thread stopped.\n");
+    }
+    m_running = false;
+}
+
+JL_LISTENER_CORE_TEMPLATE
+void JL_LISTENER_CORE::CalibrateCenter(void)
+{
+    if (!m_initialized)
+        return;
+
+    if (!m_backend.ReadCenter(m_statePrev))
+        return;
+
+    if (m_logger)
+        JL_LOG_INFO(m_logLevels, LogCategory::Lifecycle, (*m_logger) << "Joystick center calibrated.\n");
+}
+
+JL_LISTENER_CORE_TEMPLATE
+void JL_LISTENER_CORE::StartListening(void)
+{
+    if ((!m_initialized && !m_inputSource) || m_running)
+        return;
+
+    m_running = true;
+    m_thread = std::thread(&CJoystickListenerCore::ListenLoop, this);
+    m_threadConfigResult = ApplyThreadConfig(m_thread.native_handle(), m_threadConfig);
+}
+
+JL_LISTENER_CORE_TEMPLATE
+void JL_LISTENER_CORE::StopListening(void)
+{
+    if (!m_running)
+        return;
+
+    m_running = false;
+    if (m_thread.joinable())
+        m_thread.join();
+}
+
+JL_LISTENER_CORE_TEMPLATE
+bool JL_LISTENER_CORE::IsRunning(void) const
+{
+    return m_running;
+}
+
+JL_LISTENER_CORE_TEMPLATE
+bool JL_LISTENER_CORE::IsStopped(void) const
+{
+    return !m_running;
+}
+
+JL_LISTENER_CORE_TEMPLATE
+bool JL_LISTENER_CORE::IsInit(void) const
+{
+    return m_initialized;
+}
+
+JL_LISTENER_CORE_TEMPLATE
+void JL_LISTENER_CORE::SetLogger(std::shared_ptr<std::ostream> logger)
+{
+    m_logger = logger;
+}
+
+JL_LISTENER_CORE_TEMPLATE
+void JL_LISTENER_CORE::SetSilentMode(bool silentAxis, bool silentButton, bool silentButtonHeld)
+{
+    // Eski bayraklar kategori seviyelerine eslenir; susturulmayan kategori her seviyeyi yazar
+    m_logLevels.SetLevel(LogCategory::Lifecycle, silentButton ? LogLevel::Off : LogLevel::Trace);
+    m_logLevels.SetLevel(LogCategory::Axis, silentAxis ? LogLevel::Off : LogLevel::Trace);
+    m_logLevels.SetLevel(LogCategory::Button, silentButton ? LogLevel::Off : LogLevel::Trace);
+    m_logLevels.SetLevel(LogCategory::ButtonHeld, (silentButton || silentButtonHeld) ? LogLevel::Off : LogLevel::Trace);
+}
+
+JL_LISTENER_CORE_TEMPLATE
+void JL_LISTENER_CORE::SetLogLevel(LogCategory category, LogLevel level)
+{
+    m_logLevels.SetLevel(category, level);
+}
+
+JL_LISTENER_CORE_TEMPLATE
+void JL_LISTENER_CORE::SetLogRateInterval(std::chrono::milliseconds interval)
+{
+    m_logRate.SetInterval(std::chrono::duration_cast<std::chrono::nanoseconds>(interval).count());
+}
+
+JL_LISTENER_CORE_TEMPLATE
+const CLogRateLimiter& JL_LISTENER_CORE::GetLogRateLimiter(void) const
+{
+    return m_logRate;
+}
+
+JL_LISTENER_CORE_TEMPLATE
+void JL_LISTENER_CORE::ListenLoop(void)
+{
+    State state;
+    Layout::Clear(state);
+
+    ResetState();
+
+    JL_TRACE_THREAD(Backend::Name);
+    JL_ALLOC_THREAD(Backend::Name);
+
+    m_pacer.Reset();
+
+    while (m_running)
+    {
+        JL_METRICS_TICKS(pollBegin);
+
+        if (m_inputSource)
+        {
+            // Sadece bu poll'a kadar birikenleri isle; uretici hizliysa dongu kilitlenmesin.
+            bool changed = false;
+            size_t pending = m_inputSource->GetSampleQueueDepth();
+            InputSample sample;
+            while (pending-- > 0 && m_inputSource->PopSample(sample))
+            {
+                if (m_rawSampleHandler)
+                    m_rawSampleHandler(sample);
+                FromSample(sample, state);
+                changed |= ProcessState(state, sample.timestampNs);
+            }
+
+            JL_METRICS_CALL(m_metrics.OnPoll(ListenerMetricsClock::Ticks() - pollBegin, changed));
+
+            m_pacer.Wait();
+            continue;
+        }
+
+        // Hata durumunda backend sayaclari gunceller (gerekirse yeniden baglanir veya bekler)
+        const bool read = m_backend.Read(state, m_metrics);
+        const int64_t sampleTimeNs = CLoopPacer::NowNs();
+        if (!read)
+            continue;
+
+        if (m_rawSampleHandler)
+        {
+            InputSample sample;
+            ToSample(state, sampleTimeNs, sample);
+            m_rawSampleHandler(sample);
+        }
+
+        bool changed = ProcessState(state, sampleTimeNs);
+
+        JL_METRICS_CALL(m_metrics.OnPoll(ListenerMetricsClock::Ticks() - pollBegin, changed));
+
+        m_pacer.Wait();
+    }
+}
+
+JL_LISTENER_CORE_TEMPLATE
+bool JL_LISTENER_CORE::ProcessState(const State& state, int64_t sampleTimeNs)
+{
+    JL_TRACE_SPAN_BEGIN(processSpan, "Process");
+
+    int32_t raw[AxisCount];
+    int32_t rawPrev[AxisCount];
+    Layout::ReadAxes(state, raw);
+    Layout::ReadAxes(m_statePrev, rawPrev);
+
+    // Normalize veya ham; throttle Normalizer'a gore ters cevrilir
+    const bool normalize = m_normalize;
+    const bool fixedPoint = normalize && m_axisPrecision == AxisPrecision::Q15;
+    double axes[AxisCount];
+    int16_t axesQ15[AxisCount] = {};
+    bool axisMoved[AxisCount];
+    if (fixedPoint)
+    {
+        m_fixedNormalizer.Normalize(raw, axesQ15);
+        for (int i = 0; i < AxisCount; ++i)
+        {
+            axes[i] = CFixedAxisNormalizer::ToDouble(axesQ15[i]);
+            axisMoved[i] = rawPrev[i] != raw[i];
+        }
+    }
+    else
+    {
+        for (int i = 0; i < AxisCount; ++i)
+        {
+            if (i == Layout::ThrottleAxis)
+                axes[i] = normalize ? Normalizer::Throttle(raw[i]) : Normalizer::RawThrottle(raw[i]);
+            else
+                axes[i] = normalize ? Normalizer::Bipolar(raw[i]) : static_cast<double>(raw[i]);
+            axisMoved[i] = rawPrev[i] != raw[i];
+        }
+    }
+
+    const uint32_t povRaw = Layout::Pov(state);
+    const double pov = Layout::CorrectedPov(povRaw);
+
+    // eksen filtresi; kapaliysa her ham degisim olay uretir. Q15 gorunumu filtrelenmis
+    // degerden yeniden uretilir ki latest state'in iki gorunumu ayni ornegi tasisin.
+    if (m_axisFilter.IsEnabled())
+    {
+        for (int i = 0; i < AxisCount; ++i)
+        {
+            axisMoved[i] = m_axisFilter.Process(i, axes[i], sampleTimeNs, axisMoved[i]);
+            if (fixedPoint)
+                axesQ15[i] = static_cast<int16_t>(std::lround(std::clamp(axes[i], -1.0, 1.0) * 32767.0));
+        }
+    }
+
+    // latest state
+    {
+        JoystickState& latest = m_latestState.WriteBuffer();
+        for (int i = 0; i < AxisCount; ++i)
+        {
+            latest.axes[i] = axes[i];
+            latest.axesQ15[i] = axesQ15[i];
+        }
+        latest.axisCount = AxisCount;
+        latest.pov = pov;
+        for (int w = 0; w < JoystickState::MaxButtons / 32; ++w)
+            latest.buttons[w] = 0;
+        Layout::PackButtons(state, latest.buttons);
+        latest.buttonCount = ButtonCount;
+        latest.timestampNs = sampleTimeNs;
+        if (m_predictor.IsEnabled())
+            m_predictor.Estimate(latest);
+        latest.sequence = ++m_sampleSequence;
+        m_latestState.Publish();
+    }
+
+    if (m_axisVectorEnabled)
+        ProcessAxisVector(state, sampleTimeNs);
+
+    // events
+    m_events.clear();
+
+    // Held handler da kenar ister: basili tutma log ozeti birakma kenarinda kapanir
+    if (this->WantsButtons() || this->WantsButtonHeld() || m_batchHandler || m_scheduler)
+    {
+        for (int i = 0; i < ButtonCount; ++i)
+        {
+            bool prevPressed = Layout::IsPressed(m_statePrev, i);
+            bool currPressed = Layout::IsPressed(state, i);
+
+            if (prevPressed != currPressed)
+                m_events.push_back(InputEvent::Make(sampleTimeNs, m_deviceId,
+                    currPressed ? InputEventKind::ButtonDown : InputEventKind::ButtonUp, static_cast<uint16_t>(i + 1), currPressed ? 1.0f : 0.0f));
+        }
+    }
+
+    if (this->WantsButtonHeld() || m_batchHandler)
+    {
+        for (int i = 0; i < ButtonCount; ++i)
+        {
+            if (Layout::IsPressed(state, i))
+                m_events.push_back(InputEvent::Make(sampleTimeNs, m_deviceId, InputEventKind::ButtonHeld, static_cast<uint16_t>(i + 1), 1.0f));
+        }
+    }
+
+    if (this->WantsAxes() || m_batchHandler || m_scheduler)
+    {
+        for (int i = 0; i < AxisCount; ++i)
+        {
+            if (axisMoved[i])
+                m_events.push_back(InputEvent::Make(sampleTimeNs, m_deviceId, InputEventKind::Axis, static_cast<uint16_t>(i), static_cast<float>(axes[i])));
+        }
+        if (Layout::Pov(m_statePrev) != povRaw)
+            m_events.push_back(InputEvent::Make(sampleTimeNs, m_deviceId, InputEventKind::Axis, InputEvent::PovCode, static_cast<float>(pov)));
+    }
+
+    DispatchEvents(axes, pov, povRaw);
+
+    const bool changed = Layout::Changed(m_statePrev, state);
+
+    m_statePrev = state;
+
+    JL_TRACE_SPAN_END(processSpan);
+
+    return changed;
+}
+
+// Once batch handler, ardindan tekil handler'lar ayni olaylar uzerinden (adapter).
+JL_LISTENER_CORE_TEMPLATE
+void JL_LISTENER_CORE::DispatchEvents(const double (&axes)[AxisCount], double pov, uint32_t povRaw)
+{
+    if (m_events.empty())
+        return;
+
+    if (m_batchHandler)
+    {
+        JL_TRACE_SCOPE("BatchHandler");
+        JL_METRICS_TIME_HANDLER(m_metrics, m_batchHandler(std::span<const InputEvent>(m_events.data(), m_events.size())));
+    }
+
+    if (m_scheduler)
+        m_scheduler->Post(std::span<const InputEvent>(m_events.data(), m_events.size()));
+
+    bool axisChanged = false;
+
+    for (const InputEvent& evt : m_events)
+    {
+        switch (evt.kind)
+        {
+        case InputEventKind::ButtonDown:
+        case InputEventKind::ButtonUp:
+        {
+            bool pressed = evt.kind == InputEventKind::ButtonDown;
+            JL_METRICS_CALL(m_metrics.AddEvent(ListenerEventKind::ButtonEdge));
+
+            // [Button] logu baseline gibi button handler'a bagli
+            if (this->WantsButtons())
+            {
+                {
+                    JL_TRACE_SCOPE("ButtonHandler");
+                    JL_METRICS_TIME_HANDLER(m_metrics, this->OnButton(evt.code, pressed));
+                }
+                if (m_logger)
+                    JL_LOG_INFO(m_logLevels, LogCategory::Button, (*m_logger) << "[Button] " << evt.code << (pressed ? " pressed\n" : " released\n"));
+            }
+
+            // Basili tutma ozeti, Check ile ayni kosulda (held handler) kapanir
+            if (!pressed && this->WantsButtonHeld() && m_logger)
+                JL_LOG_TRACE(m_logLevels, LogCategory::ButtonHeld,
+                    LogRateSummary rate;
+                    char rateText[64];
+                    if (m_logRate.End(LogCategory::ButtonHeld, evt.code, evt.timestampNs, rate))
+                        (*m_logger) << "[Button Held] " << evt.code << " released" << rate.Format(rateText, sizeof(rateText)) << "\n");
+            break;
+        }
+
+        case InputEventKind::ButtonHeld:
+            JL_METRICS_CALL(m_metrics.AddEvent(ListenerEventKind::ButtonHeld));
+            if (!this->WantsButtonHeld())
+                break;
+
+            {
+                JL_TRACE_SCOPE("ButtonHeldHandler");
+                JL_METRICS_TIME_HANDLER(m_metrics, this->OnButtonHeld(evt.code));
+            }
+
+            // Ilk olay ve aralik basina bir ozet
+            if (m_logger)
+                JL_LOG_TRACE(m_logLevels, LogCategory::ButtonHeld,
+                    LogRateSummary rate;
+                    char rateText[64];
+                    if (m_logRate.Check(LogCategory::ButtonHeld, evt.code, evt.timestampNs, rate))
+                        (*m_logger) << "[Button Held] " << evt.code << " is being held down" << rate.Format(rateText, sizeof(rateText)) << "\n");
+            break;
+
+        case InputEventKind::Axis:
+            axisChanged = true;
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    if (axisChanged && this->WantsAxes())
+    {
+        const std::string_view povDir = MapPOV(povRaw);
+
+        if (m_logger)
+        {
+            JL_LOG_DEBUG(m_logLevels, LogCategory::Axis,
+                char line[192];
+                m_logger->write(line, FormatAxisLine(line, sizeof(line), axes, pov, povDir)));
+        }
+
+        JL_METRICS_CALL(m_metrics.AddEvent(ListenerEventKind::Axis));
+        {
+            JL_TRACE_SCOPE("AxisHandler");
+            JL_METRICS_TIME_HANDLER(m_metrics, this->OnAxes(axes, pov, povDir));
+        }
+    }
+}
+
+// Tum eksenler tek okumada; normalize ve degisim tespiti vektor uzerinde
+JL_LISTENER_CORE_TEMPLATE
+void JL_LISTENER_CORE::ProcessAxisVector(const State& state, int64_t sampleTimeNs)
+{
+    AxisVector& vector = m_latestAxisVector.WriteBuffer();
+    Layout::ReadAxisVector(state, vector.raw);
+    Layout::ReadPovs(state, vector.pov);
+    vector.timestampNs = sampleTimeNs;
+    vector.sequence = m_sampleSequence;
+
+    if (m_axisVectorProcessor.Process(vector) && m_axisVectorHandler)
+    {
+        JL_TRACE_SCOPE("AxisVectorHandler");
+        JL_METRICS_TIME_HANDLER(m_metrics, m_axisVectorHandler(vector));
+    }
+
+    m_latestAxisVector.Publish();
+}
+
+// "[Axis]   X : ...  Pov : ...  PovDir : ..." satiri, Layout::AxisLabels sirasiyla; heap kullanmaz
+JL_LISTENER_CORE_TEMPLATE
+int JL_LISTENER_CORE::FormatAxisLine(char* line, size_t size, const double (&axes)[AxisCount], double pov, std::string_view povDir)
+{
+    size_t used = 0;
+    auto append = [&](int length) {
+        if (length > 0)
+            used = std::min(used + static_cast<size_t>(length), size - 1);
+        };
+
+    append(snprintf(line, size, "[Axis] "));
+    for (int i = 0; i < AxisCount; ++i)
+        append(snprintf(line + used, size - used, "  %s : %6g", Layout::AxisLabels[i], axes[i]));
+    append(snprintf(line + used, size - used, "  Pov : %6g  PovDir : %6.*s\n", pov, static_cast<int>(povDir.size()), povDir.data()));
+    return static_cast<int>(used);
+}
+
+JL_LISTENER_CORE_TEMPLATE
+const char* JL_LISTENER_CORE::MapPOV(uint32_t pov)
+{
+    const char* povName = "Unknown";
+
+    if (pov == 0xFFFF || pov == 0xFFFFFFFF)
+        povName = "Center";
+
+    if (pov < 4500)
+        povName = "North";
+
+    if (pov >= 4500 && pov < 9000)
+        povName = "North-East";
+
+    if (pov >= 9000 && pov < 13500)
+        povName = "East";
+
+    if (pov >= 13500 && pov < 18000)
+        povName = "South-East";
+
+    if (pov >= 18000 && pov < 22500)
+        povName = "South";
+
+    if (pov >= 22500 && pov < 27000)
+        povName = "South-West";
+
+    if (pov >= 27000 && pov < 31500)
+        povName = "West";
+
+    if (pov >= 31500 && pov < 35999)
+        povName = "North-West";
+
+    return povName;
+}
+
+JL_LISTENER_CORE_TEMPLATE
+void JL_LISTENER_CORE::SetExternalObject(void* pObject)
+{
+    m_pExternalObject = pObject;
+}
+
+JL_LISTENER_CORE_TEMPLATE
+void* JL_LISTENER_CORE::GetExternalObject(void)
+{
+    return m_pExternalObject;
+}
+
+JL_LISTENER_CORE_TEMPLATE
+void JL_LISTENER_CORE::SetNormalize(bool normalize)
+{
+    m_normalize = normalize;
+}
+
+JL_LISTENER_CORE_TEMPLATE
+bool JL_LISTENER_CORE::GetNormalize(void)
+{
+    return m_normalize;
+}
+
+JL_LISTENER_CORE_TEMPLATE
+void JL_LISTENER_CORE::SetAxisPrecision(AxisPrecision precision, const FixedAxisConfig& config)
+{
+    m_axisPrecision = precision;
+    m_fixedNormalizer.Configure(AxisCount, Layout::ThrottleAxis, Normalizer::ReversesThrottle, config);
+    m_axisVectorProcessor.Configure(Layout::VectorAxes, VectorAxisCount, Layout::PovCount, Normalizer::ReversesThrottle, config);
+    if (m_initialized)
+        m_axisVectorProcessor.SetPresentMask(m_backend.GetAxisPresence());
+}
+
+JL_LISTENER_CORE_TEMPLATE
+AxisPrecision JL_LISTENER_CORE::GetAxisPrecision(void) const
+{
+    return m_axisPrecision;
+}
+
+JL_LISTENER_CORE_TEMPLATE
+void JL_LISTENER_CORE::EnableAxisVector(bool enable)
+{
+    m_axisVectorEnabled = enable;
+}
+
+JL_LISTENER_CORE_TEMPLATE
+void JL_LISTENER_CORE::SetAxisVectorHandler(AxisVectorHandler handler)
+{
+    m_axisVectorHandler = handler;
+    if (m_axisVectorHandler)
+        m_axisVectorEnabled = true;
+}
+
+JL_LISTENER_CORE_TEMPLATE
+AxisVector JL_LISTENER_CORE::GetLatestAxisVector(void)
+{
+    return m_latestAxisVector.Snapshot();
+}
+
+JL_LISTENER_CORE_TEMPLATE
+const AxisInfo& JL_LISTENER_CORE::GetAxisInfo(int index)
+{
+    return Layout::VectorAxes[index];
+}
+
+JL_LISTENER_CORE_TEMPLATE
+const CListenerMetrics& JL_LISTENER_CORE::GetMetrics(void) const
+{
+    return m_metrics;
+}
+
+JL_LISTENER_CORE_TEMPLATE
+ListenerMetricsSnapshot JL_LISTENER_CORE::GetMetricsSnapshot(void) const
+{
+    return m_metrics.Snapshot();
+}
+
+JL_LISTENER_CORE_TEMPLATE
+void JL_LISTENER_CORE::SetPollPeriod(std::chrono::microseconds period, std::chrono::microseconds spinWindow)
+{
+    m_pacer.SetPeriod(period);
+    m_pacer.SetSpinWindow(spinWindow);
+}
+
+JL_LISTENER_CORE_TEMPLATE
+PacerStats JL_LISTENER_CORE::GetPacerStats(void) const
+{
+    return m_pacer.GetStats();
+}
+
+JL_LISTENER_CORE_TEMPLATE
+void JL_LISTENER_CORE::SetThreadConfig(const ThreadConfig& config)
+{
+    m_threadConfig = config;
+}
+
+JL_LISTENER_CORE_TEMPLATE
+ThreadConfigResult JL_LISTENER_CORE::GetThreadConfigResult(void) const
+{
+    return m_threadConfigResult;
+}
+
+JL_LISTENER_CORE_TEMPLATE
+JoystickState JL_LISTENER_CORE::GetLatestState(void)
+{
+    return m_latestState.Snapshot();
+}
+
+JL_LISTENER_CORE_TEMPLATE
+void JL_LISTENER_CORE::SetRawSampleHandler(RawSampleHandler handler)
+{
+    m_rawSampleHandler = handler;
+}
+
+JL_LISTENER_CORE_TEMPLATE
+void JL_LISTENER_CORE::ResetState(void)
+{
+    Layout::Clear(m_statePrev);
+    m_axisVectorProcessor.Reset();
+    m_axisFilter.Reset();
+    m_predictor.Reset();
+}
+
+JL_LISTENER_CORE_TEMPLATE
+void JL_LISTENER_CORE::SetInputSource(CSyntheticInputSource* source)
+{
+    m_inputSource = source;
+}
+
+JL_LISTENER_CORE_TEMPLATE
+Backend& JL_LISTENER_CORE::GetBackend(void)
+{
+    return m_backend;
+}
+
+JL_LISTENER_CORE_TEMPLATE
+void JL_LISTENER_CORE::SetBatchHandler(InputBatchHandler handler)
+{
+    m_batchHandler = handler;
+}
+
+JL_LISTENER_CORE_TEMPLATE
+void JL_LISTENER_CORE::SetDeviceId(uint8_t deviceId)
+{
+    m_deviceId = deviceId;
+}
+
+JL_LISTENER_CORE_TEMPLATE
+uint8_t JL_LISTENER_CORE::GetDeviceId(void) const
+{
+    return m_deviceId;
+}
+
+JL_LISTENER_CORE_TEMPLATE
+void JL_LISTENER_CORE::SetScheduler(CInputScheduler* scheduler)
+{
+    m_scheduler = scheduler;
+}
+
+JL_LISTENER_CORE_TEMPLATE
+CInputScheduler::EventAwaiter JL_LISTENER_CORE::NextButtonEdge(int buttonId)
+{
+    if (!m_scheduler)
+        throw std::logic_error("NextButtonEdge: SetScheduler was not called");
+    return m_scheduler->NextButtonEdge(m_deviceId, buttonId);
+}
+
+JL_LISTENER_CORE_TEMPLATE
+CInputScheduler::EventAwaiter JL_LISTENER_CORE::AxisBeyond(int axis, double threshold)
+{
+    if (!m_scheduler)
+        throw std::logic_error("AxisBeyond: SetScheduler was not called");
+    return m_scheduler->AxisBeyond(m_deviceId, axis, threshold);
+}
+
+JL_LISTENER_CORE_TEMPLATE
+CInputScheduler* JL_LISTENER_CORE::GetScheduler(void) const
+{
+    return m_scheduler;
+}
+
+JL_LISTENER_CORE_TEMPLATE
+void JL_LISTENER_CORE::SetAxisFilter(const AxisFilterConfig& config)
+{
+    m_axisFilter.SetConfig(config);
+}
+
+JL_LISTENER_CORE_TEMPLATE
+AxisFilterStats JL_LISTENER_CORE::GetAxisFilterStats(void) const
+{
+    return m_axisFilter.GetStats();
+}
+
+JL_LISTENER_CORE_TEMPLATE
+void JL_LISTENER_CORE::SetPrediction(const PredictionConfig& config)
+{
+    m_predictor.SetConfig(config);
+}
+
+JL_LISTENER_CORE_TEMPLATE
+JoystickState JL_LISTENER_CORE::GetPredictedState(int64_t queryTimeNs)
+{
+    JoystickState state = GetLatestState();
+    if (m_predictor.IsEnabled())
+        CAxisPredictor::PredictState(state, queryTimeNs, m_predictor.GetConfig(), m_normalize);
+    return state;
+}
+
+#undef JL_LISTENER_CORE
+#undef JL_LISTENER_CORE_TEMPLATE
@@ -14,73 +14,165 @@
 #include <vector>
 #include <map>
 #include <memory>
+#include <algorithm>
 
 #include "ILogger.h"
+#include "JoystickListenerCore.h"
 
-class CJoystickListenerDI
+// DirectInput8 ile okuma; cihaz arayuzleri backend ile birlikte birakilir.
+class CDirectInputJoystickBackend
 {
-    const bool UseThrottleButtonAsReversed = true;
-    const bool UseThrottleButtonAsRglSlider = true;
 public:
-    using ButtonHandler = std::function<void(int buttonId, bool pressed)>;
-    using ButtonHeldHandler = std::function<void(int buttonId)>;
-    using AxisHandler = std::function<void(double x, double y, double z, double rz, double pov, std::string povDir)>;
+    using State = DIJOYSTATE2;
+    static constexpr const char* Name = "CJoystickListenerDI";
+    static constexpr const char* ThreadName = "JoyListenerDI";
 
-    ~CJoystickListenerDI();
-     CJoystickListenerDI(GUID deviceGuid);
+    explicit CDirectInputJoystickBackend(GUID deviceGuid);
+    ~CDirectInputJoystickBackend();
 
-    bool Init(void);
-    void Reset(void);
-    void Start(void);
-    void Stop(void);
-    void CalibrateCenter(void);
+    CDirectInputJoystickBackend(const CDirectInputJoystickBackend&) = delete;
+    CDirectInputJoystickBackend& operator=(const CDirectInputJoystickBackend&) = delete;
 
-    void StartListening(void);
-    void StopListening(void);
+    bool Init(std::ostream* log, const CLogLevels& levels);
+    bool Read(DIJOYSTATE2& state, CListenerMetrics& metrics);
+    bool ReadCenter(DIJOYSTATE2& prev);
 
-    bool IsRunning(void) const;
-    bool IsStopped(void) const;
-    bool IsInit(void) const;
-
-    void SetAxisHandler(AxisHandler handler);
-    void SetButtonHandler(ButtonHandler handler);
-    void SetButtonHeldHandler(ButtonHeldHandler handler);
-
-    void SetLogger(std::shared_ptr<std::ostream> logger);
-    void SetSilentMode(bool silentAxis = true, bool silentButton = true, bool silentButtonHeld = true);
-
-    void  SetExternalObject(void* pObject);
-    void* GetExternalObject(void);
-
-    void SetNormalize(bool normalize);
-    bool GetNormalize(void);
+    // DIAxisLayout::VectorAxes sirasiyla cihazda bulunan eksenler; Init'ten once tum bitler 1
+    uint32_t GetAxisPresence(void) const { return m_axisPresence; }
 
 private:
-    void ListenLoop(void);
-
+    GUID m_deviceGuid;
     LPDIRECTINPUT8 m_directInput;
     LPDIRECTINPUTDEVICE8 m_joystickDevice;
-    GUID m_deviceGuid;
-
-    std::thread m_thread;
-    std::atomic<bool> m_running;
-    std::atomic<bool> m_initialized;
-    std::atomic<bool> m_silentAxis;
-    std::atomic<bool> m_silentButton;
-    std::atomic<bool> m_silentButtonHeld;
-
-    AxisHandler m_axisHandler;
-    ButtonHandler m_buttonHandler;
-    ButtonHeldHandler m_buttonHeldHandler;
-
-    DIJOYSTATE2 m_joyStatePrev;
-
-    //std::shared_ptr<ILogger> m_logger;
-    std::shared_ptr<std::ostream> m_logger;
+    uint32_t m_axisPresence;
+};
 
-    std::string MapPOV(DWORD pov);
+// DIJOYSTATE2: X/Y/Z/RZ, 128 buton, ilk POV.
+// ThrottleOnSlider: throttle (Z) lZ yerine rglSlider[0]'dan okunur.
+// Eksen vektoru: konum, hiz, ivme ve kuvvet bloklarinin 8'er ekseni (32) ve 4 POV.
+// Hiz/ivme/kuvvet eksenleri Init'te -32767..32767 araligina alinir (AxisRange::Signed); ham 0 = 0.0.
+template<bool ThrottleOnSlider = true>
+struct DIAxisLayout
+{
+    using State = DIJOYSTATE2;
+
+    static constexpr int AxisCount = 4;
+    static constexpr int ThrottleAxis = JoystickState::AxisZ;
+    static constexpr int ButtonCount = 128;
+    static constexpr const char* AxisLabels[AxisCount] = { "X", "Y", "Z", "RZ" };
+
+    static constexpr int VectorAxisCount = 32;
+    static constexpr int PovCount = 4;
+    static constexpr AxisInfo VectorAxes[VectorAxisCount] = {
+        { "X",  AxisAspect::Position, AxisRange::Bipolar }, { "Y",  AxisAspect::Position, AxisRange::Bipolar },
+        { "Z",  AxisAspect::Position, AxisRange::Bipolar }, { "RX", AxisAspect::Position, AxisRange::Bipolar },
+        { "RY", AxisAspect::Position, AxisRange::Bipolar }, { "RZ", AxisAspect::Position, AxisRange::Bipolar },
+        { "Slider0", AxisAspect::Position, AxisRange::Unipolar }, { "Slider1", AxisAspect::Position, AxisRange::Unipolar },
+        { "VX",  AxisAspect::Velocity, AxisRange::Signed }, { "VY",  AxisAspect::Velocity, AxisRange::Signed },
+        { "VZ",  AxisAspect::Velocity, AxisRange::Signed }, { "VRX", AxisAspect::Velocity, AxisRange::Signed },
+        { "VRY", AxisAspect::Velocity, AxisRange::Signed }, { "VRZ", AxisAspect::Velocity, AxisRange::Signed },
+        { "VSlider0", AxisAspect::Velocity, AxisRange::Signed }, { "VSlider1", AxisAspect::Velocity, AxisRange::Signed },
+        { "AX",  AxisAspect::Acceleration, AxisRange::Signed }, { "AY",  AxisAspect::Acceleration, AxisRange::Signed },
+        { "AZ",  AxisAspect::Acceleration, AxisRange::Signed }, { "ARX", AxisAspect::Acceleration, AxisRange::Signed },
+        { "ARY", AxisAspect::Acceleration, AxisRange::Signed }, { "ARZ", AxisAspect::Acceleration, AxisRange::Signed },
+        { "ASlider0", AxisAspect::Acceleration, AxisRange::Signed }, { "ASlider1", AxisAspect::Acceleration, AxisRange::Signed },
+        { "FX",  AxisAspect::Force, AxisRange::Signed }, { "FY",  AxisAspect::Force, AxisRange::Signed },
+        { "FZ",  AxisAspect::Force, AxisRange::Signed }, { "FRX", AxisAspect::Force, AxisRange::Signed },
+        { "FRY", AxisAspect::Force, AxisRange::Signed }, { "FRZ", AxisAspect::Force, AxisRange::Signed },
+        { "FSlider0", AxisAspect::Force, AxisRange::Signed }, { "FSlider1", AxisAspect::Force, AxisRange::Signed },
+    };
+
+    // Her blok (lX.., lVX.., lAX.., lFX..) 8 ardisik LONG; alan basina kod yok
+    static constexpr size_t VectorBlockOffsets[VectorAxisCount / 8] = {
+        offsetof(DIJOYSTATE2, lX), offsetof(DIJOYSTATE2, lVX), offsetof(DIJOYSTATE2, lAX), offsetof(DIJOYSTATE2, lFX)
+    };
+
+    static void ReadAxisVector(const DIJOYSTATE2& state, int32_t* axes)
+    {
+        static_assert(sizeof(LONG) == sizeof(int32_t), "DIJOYSTATE2 axes are 32-bit");
+        const char* base = reinterpret_cast<const char*>(&state);
+        for (size_t block = 0; block < VectorAxisCount / 8; ++block)
+            memcpy(axes + block * 8, base + VectorBlockOffsets[block], 8 * sizeof(int32_t));
+    }
+
+    static void ReadPovs(const DIJOYSTATE2& state, uint32_t* povs)
+    {
+        memcpy(povs, state.rgdwPOV, PovCount * sizeof(uint32_t));
+    }
+
+    static void Clear(DIJOYSTATE2& state)
+    {
+        ZeroMemory(&state, sizeof(state));
+    }
+
+    static void ReadAxes(const DIJOYSTATE2& state, int32_t (&axes)[AxisCount])
+    {
+        axes[JoystickState::AxisX] = state.lX;
+        axes[JoystickState::AxisY] = state.lY;
+        axes[JoystickState::AxisZ] = ThrottleOnSlider ? state.rglSlider[0] : state.lZ;
+        axes[JoystickState::AxisRZ] = state.lRz;
+    }
+
+    static bool IsPressed(const DIJOYSTATE2& state, int i)      { return (state.rgbButtons[i] & 0x80) != 0; }
+
+    static void PackButtons(const DIJOYSTATE2& state, uint32_t* words)
+    {
+        for (int i = 0; i < ButtonCount; ++i)
+        {
+            if (state.rgbButtons[i] & 0x80)
+                words[i >> 5] |= (1u << (i & 31));
+        }
+    }
+
+    static uint32_t Pov(const DIJOYSTATE2& state)               { return state.rgdwPOV[0]; }
+    static double CorrectedPov(uint32_t pov)                    { return pov == 0xFFFFFFFF ? 65535 : pov; }
+
+    static bool Changed(const DIJOYSTATE2& prev, const DIJOYSTATE2& curr)
+    {
+        return memcmp(&prev, &curr, sizeof(DIJOYSTATE2)) != 0;
+    }
+
+    static void ToSample(const DIJOYSTATE2& joyState, int64_t timestampNs, InputSample& sample)
+    {
+        ZeroMemory(&sample, sizeof(sample));
+        sample.timestampNs = timestampNs;
+        sample.axes[0] = joyState.lX;
+        sample.axes[1] = joyState.lY;
+        sample.axes[2] = joyState.lZ;
+        sample.axes[3] = joyState.lRx;
+        sample.axes[4] = joyState.lRy;
+        sample.axes[5] = joyState.lRz;
+        sample.axes[6] = joyState.rglSlider[0];
+        sample.axes[7] = joyState.rglSlider[1];
+        for (int i = 0; i < 4; ++i)
+            sample.pov[i] = joyState.rgdwPOV[i];
+        PackButtons(joyState, sample.buttons);
+    }
+
+    static void FromSample(const InputSample& sample, DIJOYSTATE2& joyState)
+    {
+        ZeroMemory(&joyState, sizeof(joyState));
+        joyState.lX = sample.axes[0];
+        joyState.lY = sample.axes[1];
+        joyState.lZ = sample.axes[2];
+        joyState.lRx = sample.axes[3];
+        joyState.lRy = sample.axes[4];
+        joyState.lRz = sample.axes[5];
+        joyState.rglSlider[0] = sample.axes[6];
+        joyState.rglSlider[1] = sample.axes[7];
+        for (int i = 0; i < 4; ++i)
+            joyState.rgdwPOV[i] = sample.pov[i];
+        for (int i = 0; i < ButtonCount; ++i)
+            joyState.rgbButtons[i] = sample.IsButtonPressed(i) ? 0x80 : 0;
+    }
+};
 
-    void* m_pExternalObject;
+using CJoystickListenerDIBase = CJoystickListenerCore<CDirectInputJoystickBackend, DIAxisLayout<true>, AxisNormalizer<true>, CFunctionDispatch<4>>;
+extern template class CJoystickListenerCore<CDirectInputJoystickBackend, DIAxisLayout<true>, AxisNormalizer<true>, CFunctionDispatch<4>>;
 
-    std::atomic<bool> m_normalize;
+// DirectInput joystick: throttle rglSlider[0]'dan ve ters, std::function callback'ler.
+class CJoystickListenerDI : public CJoystickListenerDIBase
+{
+public:
+    CJoystickListenerDI(GUID deviceGuid);
 };
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+
+// Bir poll'daki tum eksen, POV ve buton degerlerinin tutarli kopyasi.
+// Eksen degerleri listener'in axis handler'a verdigi (normalize edilmis veya ham,
+// throttle ters cevrilmis) degerlerdir.
+struct JoystickState
+{
+    enum Axis
+    {
+        AxisX = 0,
+        AxisY,
+        AxisZ,
+        AxisRZ,
+        MaxAxes = 8
+    };
+
+    static const int MaxButtons = 128;
+
+    double   axes[MaxAxes] = {};
+    int16_t  axesQ15[MaxAxes] = {};     // AxisPrecision::Q15 iken axes'in tamsayi hali (1.0 = 32767, filtre sonrasi), degilse 0
+    int      axisCount = 0;
+
+    // Tahmin acikken listener'in son orneklerden kestirdigi turevler (birim/s, birim/s^2).
+    double   axisRate[MaxAxes] = {};
+    double   axisAccel[MaxAxes] = {};
+    double   pov = 65535;
+    uint32_t buttons[MaxButtons / 32] = {};
+    int      buttonCount = 0;
+
+    int64_t  timestampNs = 0;   // CLoopPacer::NowNs() ile ayni monoton saat
+    uint64_t sequence = 0;      // 0 ise henuz ornek yok
+
+    bool IsButtonPressed(int buttonId) const
+    {
+        int i = buttonId - 1;
+        if (i < 0 || i >= buttonCount)
+            return false;
+        return (buttons[i >> 5] & (1u << (i & 31))) != 0;
+    }
+
+    void SetButton(int buttonId, bool pressed)
+    {
+        int i = buttonId - 1;
+        if (i < 0 || i >= MaxButtons)
+            return;
+        if (pressed)
+            buttons[i >> 5] |= (1u << (i & 31));
+        else
+            buttons[i >> 5] &= ~(1u << (i & 31));
+    }
+};
@@ -0,0 +1,307 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+// VK kodu <-> tus adi tablolari. Tamami derleme zamaninda uretilir; Windows.h,
+// sistem cagrisi veya bellek ayirma gerektirmez (headless / Linux'ta da calisir).
+// Adlar ABD klavye dizilimine goredir.
+namespace KeyNames
+{
+    struct NamedKey
+    {
+        uint8_t          vk;
+        std::string_view name;
+        std::string_view shifted;   // bos ise name
+    };
+
+    inline constexpr NamedKey NamedKeys[] =
+    {
+        { 0x01, "Mouse Left", {} },     { 0x02, "Mouse Right", {} },    { 0x03, "Cancel", {} },
+        { 0x04, "Mouse Middle", {} },   { 0x05, "Mouse X1", {} },       { 0x06, "Mouse X2", {} },
+        { 0x08, "Backspace", {} },      { 0x09, "Tab", {} },            { 0x0C, "Clear", {} },
+        { 0x0D, "Enter", {} },          { 0x10, "Shift", {} },          { 0x11, "Ctrl", {} },
+        { 0x12, "Alt", {} },            { 0x13, "Pause", {} },          { 0x14, "CapsLock", {} },
+        { 0x15, "Kana", {} },           { 0x16, "ImeOn", {} },          { 0x17, "Junja", {} },
+        { 0x18, "Final", {} },          { 0x19, "Kanji", {} },          { 0x1A, "ImeOff", {} },
+        { 0x1B, "Escape", {} },         { 0x1C, "Convert", {} },        { 0x1D, "NonConvert", {} },
+        { 0x1E, "Accept", {} },         { 0x1F, "ModeChange", {} },     { 0x20, "Space", {} },
+        { 0x21, "PageUp", {} },         { 0x22, "PageDown", {} },       { 0x23, "End", {} },
+        { 0x24, "Home", {} },           { 0x25, "ArrowLeft", {} },      { 0x26, "ArrowUp", {} },
+        { 0x27, "ArrowRight", {} },     { 0x28, "ArrowDown", {} },      { 0x29, "Select", {} },
+        { 0x2A, "Print", {} },          { 0x2B, "Execute", {} },        { 0x2C, "PrintScreen", {} },
+        { 0x2D, "Insert", {} },         { 0x2E, "Delete", {} },         { 0x2F, "Help", {} },
+
+        { 0x30, "0", ")" }, { 0x31, "1", "!" }, { 0x32, "2", "@" }, { 0x33, "3", "#" }, { 0x34, "4", "$" },
+        { 0x35, "5", "%" }, { 0x36, "6", "^" }, { 0x37, "7", "&" }, { 0x38, "8", "*" }, { 0x39, "9", "(" },
+
+        { 0x41, "A", {} }, { 0x42, "B", {} }, { 0x43, "C", {} }, { 0x44, "D", {} }, { 0x45, "E", {} },
+        { 0x46, "F", {} }, { 0x47, "G", {} }, { 0x48, "H", {} }, { 0x49, "I", {} }, { 0x4A, "J", {} },
+        { 0x4B, "K", {} }, { 0x4C, "L", {} }, { 0x4D, "M", {} }, { 0x4E, "N", {} }, { 0x4F, "O", {} },
+        { 0x50, "P", {} }, { 0x51, "Q", {} }, { 0x52, "R", {} }, { 0x53, "S", {} }, { 0x54, "T", {} },
+        { 0x55, "U", {} }, { 0x56, "V", {} }, { 0x57, "W", {} }, { 0x58, "X", {} }, { 0x59, "Y", {} },
+        { 0x5A, "Z", {} },
+
+        { 0x5B, "LeftWin", {} },        { 0x5C, "RightWin", {} },       { 0x5D, "Apps", {} },
+        { 0x5F, "Sleep", {} },
+
+        { 0x60, "Num0", {} }, { 0x61, "Num1", {} }, { 0x62, "Num2", {} }, { 0x63, "Num3", {} }, { 0x64, "Num4", {} },
+        { 0x65, "Num5", {} }, { 0x66, "Num6", {} }, { 0x67, "Num7", {} }, { 0x68, "Num8", {} }, { 0x69, "Num9", {} },
+        { 0x6A, "NumMultiply", {} },    { 0x6B, "NumAdd", {} },         { 0x6C, "NumSeparator", {} },
+        { 0x6D, "NumSubtract", {} },    { 0x6E, "NumDecimal", {} },     { 0x6F, "NumDivide", {} },
+
+        { 0x70, "F1", {} },  { 0x71, "F2", {} },  { 0x72, "F3", {} },  { 0x73, "F4", {} },  { 0x74, "F5", {} },
+        { 0x75, "F6", {} },  { 0x76, "F7", {} },  { 0x77, "F8", {} },  { 0x78, "F9", {} },  { 0x79, "F10", {} },
+        { 0x7A, "F11", {} }, { 0x7B, "F12", {} }, { 0x7C, "F13", {} }, { 0x7D, "F14", {} }, { 0x7E, "F15", {} },
+        { 0x7F, "F16", {} }, { 0x80, "F17", {} }, { 0x81, "F18", {} }, { 0x82, "F19", {} }, { 0x83, "F20", {} },
+        { 0x84, "F21", {} }, { 0x85, "F22", {} }, { 0x86, "F23", {} }, { 0x87, "F24", {} },
+
+        { 0x90, "NumLock", {} },        { 0x91, "ScrollLock", {} },
+        { 0xA0, "LeftShift", {} },      { 0xA1, "RightShift", {} },     { 0xA2, "LeftCtrl", {} },
+        { 0xA3, "RightCtrl", {} },      { 0xA4, "LeftAlt", {} },        { 0xA5, "RightAlt", {} },
+        { 0xA6, "BrowserBack", {} },    { 0xA7, "BrowserForward", {} }, { 0xA8, "BrowserRefresh", {} },
+        { 0xA9, "BrowserStop", {} },    { 0xAA, "BrowserSearch", {} },  { 0xAB, "BrowserFavorites", {} },
+        { 0xAC, "BrowserHome", {} },    { 0xAD, "VolumeMute", {} },     { 0xAE, "VolumeDown", {} },
+        { 0xAF, "VolumeUp", {} },       { 0xB0, "MediaNext", {} },      { 0xB1, "MediaPrev", {} },
+        { 0xB2, "MediaStop", {} },      { 0xB3, "MediaPlayPause", {} }, { 0xB4, "LaunchMail", {} },
+        { 0xB5, "LaunchMedia", {} },    { 0xB6, "LaunchApp1", {} },     { 0xB7, "LaunchApp2", {} },
+
+        { 0xBA, ";", ":" },  { 0xBB, "=", "+" },  { 0xBC, ",", "<" },  { 0xBD, "-", "_" },  { 0xBE, ".", ">" },
+        { 0xBF, "/", "?" },  { 0xC0, "`", "~" },  { 0xDB, "[", "{" },  { 0xDC, "\\", "|" }, { 0xDD, "]", "}" },
+        { 0xDE, "'", "\"" }, { 0xDF, "Oem8", {} }, { 0xE2, "Oem102", {} },
+
+        { 0xE5, "ImeProcess", {} },     { 0xE7, "Packet", {} },         { 0xF6, "Attn", {} },
+        { 0xF7, "CrSel", {} },          { 0xF8, "ExSel", {} },          { 0xF9, "EraseEof", {} },
+        { 0xFA, "Play", {} },           { 0xFB, "Zoom", {} },           { 0xFD, "Pa1", {} },
+        { 0xFE, "OemClear", {} },
+    };
+
+    // Adi olmayan kodlar "0xNN" olarak adlandirilir
+    constexpr std::array<std::array<char, 4>, 256> MakeHexNames()
+    {
+        constexpr char digits[] = "0123456789ABCDEF";
+        std::array<std::array<char, 4>, 256> names{};
+        for (int i = 0; i < 256; ++i)
+            names[i] = { '0', 'x', digits[i >> 4], digits[i & 15] };
+        return names;
+    }
+
+    inline constexpr auto HexNames = MakeHexNames();
+
+    constexpr std::array<std::string_view, 256> MakeNameTable(bool shifted)
+    {
+        std::array<std::string_view, 256> table{};
+        for (int i = 0; i < 256; ++i)
+            table[i] = std::string_view(HexNames[i].data(), HexNames[i].size());
+        for (const NamedKey& key : NamedKeys)
+            table[key.vk] = (shifted && !key.shifted.empty()) ? key.shifted : key.name;
+        return table;
+    }
+
+    inline constexpr std::array<std::string_view, 256> Names = MakeNameTable(false);
+    inline constexpr std::array<std::string_view, 256> ShiftedNames = MakeNameTable(true);
+
+    constexpr std::string_view KeyName(int vk, bool shiftPressed = false)
+    {
+        if (vk < 0 || vk > 255)
+            return "Unknown";
+        return shiftPressed ? ShiftedNames[vk] : Names[vk];
+    }
+
+    // --- Ad -> VK: derleme zamaninda kurulan mukemmel ozet (hash + displace) ---
+
+    constexpr char ToLower(char c)
+    {
+        return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+    }
+
+    constexpr bool EqualsNoCase(std::string_view a, std::string_view b)
+    {
+        if (a.size() != b.size())
+            return false;
+        for (size_t i = 0; i < a.size(); ++i)
+        {
+            if (ToLower(a[i]) != ToLower(b[i]))
+                return false;
+        }
+        return true;
+    }
+
+    constexpr uint32_t HashName(std::string_view name, uint32_t seed)
+    {
+        uint32_t h = 2166136261u ^ (seed * 0x9E3779B9u);
+        for (char c : name)
+        {
+            h ^= static_cast<uint8_t>(ToLower(c));
+            h *= 16777619u;
+        }
+        return h ^ (h >> 15);
+    }
+
+    inline constexpr int BucketCount = 64;
+    inline constexpr int SlotCount = 512;
+    inline constexpr int MaxBucketSize = 16;
+
+    struct PerfectHash
+    {
+        std::array<uint16_t, BucketCount> seeds{};
+        std::array<uint8_t, SlotCount> slots{};     // 0: bos (VK 0 kullanilmaz)
+    };
+
+    constexpr PerfectHash BuildPerfectHash()
+    {
+        PerfectHash hash{};
+
+        std::array<std::array<uint8_t, MaxBucketSize>, BucketCount> buckets{};
+        std::array<int, BucketCount> sizes{};
+        for (const NamedKey& key : NamedKeys)
+        {
+            const uint32_t b = HashName(key.name, 0) % BucketCount;
+            if (sizes[b] == MaxBucketSize)
+                throw "KeyNames: MaxBucketSize too small";
+            buckets[b][sizes[b]++] = key.vk;
+        }
+
+        // Buyuk kovalar once yerlesir
+        std::array<int, BucketCount> order{};
+        for (int i = 0; i < BucketCount; ++i)
+            order[i] = i;
+        for (int i = 0; i < BucketCount; ++i)
+        {
+            for (int j = i + 1; j < BucketCount; ++j)
+            {
+                if (sizes[order[j]] > sizes[order[i]])
+                {
+                    const int t = order[i];
+                    order[i] = order[j];
+                    order[j] = t;
+                }
+            }
+        }
+
+        for (int b : order)
+        {
+            if (sizes[b] == 0)
+                continue;
+
+            for (uint32_t seed = 1; ; ++seed)
+            {
+                if (seed > 0xFFFF)
+                    throw "KeyNames: no displacement found";
+
+                std::array<int, MaxBucketSize> placed{};
+                bool ok = true;
+                for (int k = 0; k < sizes[b] && ok; ++k)
+                {
+                    const int slot = static_cast<int>(HashName(Names[buckets[b][k]], seed) % SlotCount);
+                    ok = hash.slots[slot] == 0;
+                    for (int p = 0; p < k && ok; ++p)
+                        ok = placed[p] != slot;
+                    placed[k] = slot;
+                }
+
+                if (ok)
+                {
+                    for (int k = 0; k < sizes[b]; ++k)
+                        hash.slots[placed[k]] = buckets[b][k];
+                    hash.seeds[b] = static_cast<uint16_t>(seed);
+                    break;
+                }
+            }
+        }
+
+        return hash;
+    }
+
+    inline constexpr PerfectHash NameHash = BuildPerfectHash();
+
+    // Buyuk/kucuk harf duyarsiz; "0x41" bicimi de kabul edilir. Bilinmiyorsa 0.
+    constexpr int VkFromName(std::string_view name)
+    {
+        if (name.empty())
+            return 0;
+
+        if (name.size() == 4 && name[0] == '0' && (name[1] == 'x' || name[1] == 'X'))
+        {
+            int value = 0;
+            for (int i = 2; i < 4; ++i)
+            {
+                const char c = ToLower(name[i]);
+                const int d = (c >= '0' && c <= '9') ? c - '0' : (c >= 'a' && c <= 'f') ? c - 'a' + 10 : -1;
+                if (d < 0)
+                    return 0;
+                value = value * 16 + d;
+            }
+            return value;
+        }
+
+        const uint32_t seed = NameHash.seeds[HashName(name, 0) % BucketCount];
+        const uint8_t vk = NameHash.slots[HashName(name, seed) % SlotCount];
+        return (vk != 0 && EqualsNoCase(Names[vk], name)) ? vk : 0;
+    }
+
+    // --- Linux evdev (linux/input-event-codes.h KEY_*) -> VK ---
+
+    constexpr std::array<uint8_t, 256> MakeLinuxKeycodeTable()
+    {
+        std::array<uint8_t, 256> t{};
+
+        t[1] = 0x1B;                                        // KEY_ESC
+        for (int i = 0; i < 9; ++i)
+            t[2 + i] = static_cast<uint8_t>('1' + i);       // KEY_1..KEY_9
+        t[11] = '0';
+        t[12] = 0xBD; t[13] = 0xBB; t[14] = 0x08; t[15] = 0x09;             // - = Backspace Tab
+
+        const char row1[] = "QWERTYUIOP";
+        for (int i = 0; i < 10; ++i)
+            t[16 + i] = static_cast<uint8_t>(row1[i]);
+        t[26] = 0xDB; t[27] = 0xDD; t[28] = 0x0D; t[29] = 0xA2;             // [ ] Enter LeftCtrl
+
+        const char row2[] = "ASDFGHJKL";
+        for (int i = 0; i < 9; ++i)
+            t[30 + i] = static_cast<uint8_t>(row2[i]);
+        t[39] = 0xBA; t[40] = 0xDE; t[41] = 0xC0; t[42] = 0xA0; t[43] = 0xDC; // ; ' ` LeftShift backslash
+
+        const char row3[] = "ZXCVBNM";
+        for (int i = 0; i < 7; ++i)
+            t[44 + i] = static_cast<uint8_t>(row3[i]);
+        t[51] = 0xBC; t[52] = 0xBE; t[53] = 0xBF; t[54] = 0xA1;             // , . / RightShift
+        t[55] = 0x6A; t[56] = 0xA4; t[57] = 0x20; t[58] = 0x14;             // KP* LeftAlt Space CapsLock
+
+        for (int i = 0; i < 10; ++i)
+            t[59 + i] = static_cast<uint8_t>(0x70 + i);     // KEY_F1..KEY_F10
+        t[69] = 0x90; t[70] = 0x91;                         // NumLock ScrollLock
+
+        t[71] = 0x67; t[72] = 0x68; t[73] = 0x69; t[74] = 0x6D;             // KP7 KP8 KP9 KP-
+        t[75] = 0x64; t[76] = 0x65; t[77] = 0x66; t[78] = 0x6B;             // KP4 KP5 KP6 KP+
+        t[79] = 0x61; t[80] = 0x62; t[81] = 0x63; t[82] = 0x60; t[83] = 0x6E; // KP1 KP2 KP3 KP0 KP.
+
+        t[86] = 0xE2; t[87] = 0x7A; t[88] = 0x7B;           // KEY_102ND F11 F12
+        t[96] = 0x0D; t[97] = 0xA3; t[98] = 0x6F; t[99] = 0x2C;             // KPEnter RightCtrl KP/ SysRq
+        t[100] = 0xA5; t[102] = 0x24; t[103] = 0x26; t[104] = 0x21;         // RightAlt Home Up PageUp
+        t[105] = 0x25; t[106] = 0x27; t[107] = 0x23; t[108] = 0x28;         // Left Right End Down
+        t[109] = 0x22; t[110] = 0x2D; t[111] = 0x2E;                        // PageDown Insert Delete
+        t[113] = 0xAD; t[114] = 0xAE; t[115] = 0xAF; t[119] = 0x13;         // Mute VolDown VolUp Pause
+        t[121] = 0x6C; t[125] = 0x5B; t[126] = 0x5C; t[127] = 0x5D;         // KPComma LeftMeta RightMeta Compose
+        t[142] = 0x5F; t[163] = 0xB0; t[164] = 0xB3; t[165] = 0xB1; t[166] = 0xB2;  // Sleep media
+        t[158] = 0xA6; t[159] = 0xA7; t[172] = 0xAC; t[173] = 0xA8; t[217] = 0xAA;  // browser
+
+        for (int i = 0; i < 12; ++i)
+            t[183 + i] = static_cast<uint8_t>(0x7C + i);    // KEY_F13..KEY_F24
+        return t;
+    }
+
+    inline constexpr std::array<uint8_t, 256> LinuxKeycodeToVk = MakeLinuxKeycodeTable();
+
+    // evdev tus kodu; eslesme yoksa 0. X11 keycode'lari icin keycode - 8 verilir.
+    constexpr int VkFromLinuxKeycode(int keycode)
+    {
+        return (keycode >= 0 && keycode < 256) ? LinuxKeycodeToVk[keycode] : 0;
+    }
+
+    static_assert(KeyName(0x20) == "Space" && KeyName(0x31, true) == "!" && KeyName(0xE8) == "0xE8", "KeyNames: name table");
+    static_assert(VkFromName("Space") == 0x20 && VkFromName("leftctrl") == 0xA2 && VkFromName("F24") == 0x87, "KeyNames: reverse map");
+    static_assert(VkFromName("0x41") == 0x41 && VkFromName("NoSuchKey") == 0, "KeyNames: reverse map");
+    static_assert(VkFromLinuxKeycode(30) == 'A' && VkFromLinuxKeycode(57) == 0x20, "KeyNames: evdev table");
+}
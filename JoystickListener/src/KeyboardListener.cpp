@@ -1,11 +1,22 @@
 #include "KeyboardListener.h"
 #include "ConsoleLogger.h"
-#include "KeyboardUtils.h"
+#include "KeyNames.h"
+#include "AllocationTracker.h"
+#include "TraceRecorder.h"
 #include <Windows.h>
+#include <algorithm>
+#include <cstdarg>
+#include <cstdio>
 
 CKeyboardListener::CKeyboardListener()
-    : m_running(false), m_initialized(false), m_silentMode(false) 
+    : m_running(false), m_initialized(false), m_logLevels(LogLevel::Trace), m_metrics("CKeyboardListener"),
+      m_pacer(std::chrono::milliseconds(30)), m_inputSource(nullptr), m_deviceId(InputEvent::KeyboardDeviceId), m_logUsed(0)
 {
+    m_events.reserve(256);
+    m_logViews.reserve(256);
+    m_threadConfig.name = "KeyListener";
+    std::fill(std::begin(m_keyState), std::end(m_keyState), false);
+    std::fill(std::begin(m_keyHistoryUsed), std::end(m_keyHistoryUsed), false);
     m_logger = std::make_shared<ConsoleLogger>();
 }
 
@@ -15,26 +26,23 @@ CKeyboardListener::~CKeyboardListener() {
 
 void CKeyboardListener::Init() {
     m_initialized = true;
-    if (!m_silentMode) {
-        m_logger->Log("[CKeyboardListener] Init completed.");
-    }
+    JL_LOG_INFO(m_logLevels, LogCategory::Lifecycle, m_logger->Log("[CKeyboardListener] Init completed."));
 }
 
 void CKeyboardListener::Reset() {
     Stop();
     m_initialized = false;
-    if (!m_silentMode) {
-        m_logger->Log("[CKeyboardListener] Reset completed.");
-    }
+    JL_LOG_INFO(m_logLevels, LogCategory::Lifecycle, m_logger->Log("[CKeyboardListener] Reset completed."));
 }
 
 void CKeyboardListener::Start() {
     if (m_initialized && !m_running) {
         m_running = true;
         m_thread = std::thread(&CKeyboardListener::ListenLoop, this);
-        if (!m_silentMode) {
+        m_threadConfigResult = ApplyThreadConfig(m_thread.native_handle(), m_threadConfig);
+        JL_LOG_INFO(m_logLevels, LogCategory::Lifecycle,
             m_logger->Log("[CKeyboardListener] Listening thread started.");
-        }
+            m_logger->Log("[CKeyboardListener] Thread : " + m_threadConfigResult.ToString()));
     }
 }
 
@@ -46,9 +54,7 @@ void CKeyboardListener::Stop() {
     }
     if (wasRunning)
     {
-        if (!m_silentMode) {
-            m_logger->Log("[CKeyboardListener] Listening thread stopped.");
-        }
+        JL_LOG_INFO(m_logLevels, LogCategory::Lifecycle, m_logger->Log("[CKeyboardListener] Listening thread stopped."));
     }
     m_running = false;
 }
@@ -67,111 +73,253 @@ void CKeyboardListener::RegisterHandler(int vk, std::function<void(const KeyEven
 }
 
 void CKeyboardListener::ClearKeyHistory() {
-    m_keyHistory.clear();
+    std::fill(std::begin(m_keyHistory), std::end(m_keyHistory), KeyHistory());
+    std::fill(std::begin(m_keyHistoryUsed), std::end(m_keyHistoryUsed), false);
 }
 
 const std::unordered_map<int, KeyHistory> CKeyboardListener::GetKeyHistory() const {
-    return m_keyHistory;
+    return GetKeyHistoryCopy();
 }
 
 std::unordered_map<int, KeyHistory> CKeyboardListener::GetKeyHistoryCopy() const {
-    return m_keyHistory;
+    std::unordered_map<int, KeyHistory> history;
+    for (int vk = 0; vk < 256; ++vk) {
+        if (m_keyHistoryUsed[vk])
+            history[vk] = m_keyHistory[vk];
+    }
+    return history;
 }
 
 void CKeyboardListener::ListenLoop() {
-    if (!m_silentMode) {
-        m_logger->Log("[CKeyboardListener] Dinleme baslatildi. ESC ile cikabilirsiniz.");
-    }
-    bool keyState[256] = { false };
+    JL_LOG_INFO(m_logLevels, LogCategory::Lifecycle, m_logger->Log("[CKeyboardListener] Dinleme baslatildi. ESC ile cikabilirsiniz."));
+    std::fill(std::begin(m_keyState), std::end(m_keyState), false);
+
+    JL_TRACE_THREAD("CKeyboardListener");
+    JL_ALLOC_THREAD("CKeyboardListener");
+    m_pacer.Reset();
 
     while (m_running) {
-        for (int vk = 1; vk <= 254; ++vk) {
-            SHORT state = GetAsyncKeyState(vk);
-            bool isCurrentlyPressed = (state & 0x8000) != 0;
-            bool wasPreviouslyPressed = keyState[vk];
-
-            bool shift = (GetAsyncKeyState(VK_SHIFT) & 0x8000);
-            bool ctrl  = (GetAsyncKeyState(VK_CONTROL) & 0x8000);
-            bool alt   = (GetAsyncKeyState(VK_MENU) & 0x8000);
-
-            KeyHistory& hist = m_keyHistory[vk];
-            hist.wasPressed  = hist.isPressed;
-            hist.wasReleased = hist.isReleased;
-            hist.isPressed   = isCurrentlyPressed;
-            hist.isReleased  = !isCurrentlyPressed;
-
-            if (isCurrentlyPressed && !wasPreviouslyPressed) {
-                keyState[vk] = true;
-                KeyEvent evt{ vk, KeyState::Down, shift, ctrl, alt };
-                m_keyHistory[vk].pressCount++;
-                m_keyHistory[vk].currentHoldCount = 1;
-                //m_keyHistory[vk].isPressed = true;
-                m_keyHistory[vk].lastState = KeyState::Down;
-                m_keyHistory[vk].lastPressedTime = std::chrono::steady_clock::now();
-
-                if (!m_silentMode) {
-                    m_logger->Log("[Down] " + GetKeyName(vk) + " (" + std::to_string(vk) + ")");
-                }
-                auto it = m_handlers.find(vk);
-                //if (it != m_handlers2.end()) it->second(evt);
-                if (it != m_handlers.end()) {
-                    for (auto& handler : it->second)
-                        handler(evt);
-                }                    
-                if (vk == VK_ESCAPE) {
-                    if (!m_silentMode) {
-                        m_logger->Log("[CKeyboardListener] ESC algilandi, cikiliyor.");
-                    }
-                    m_running = false;
-                    break;
-                }
+        JL_TRACE_SPAN_BEGIN(scanSpan, "Scan");
+        JL_METRICS_TICKS(pollBegin);
+        [[maybe_unused]] bool anyEdge = false;     // yalnizca metrikler derliyse okunur
+        const int64_t scanTimeNs = CLoopPacer::NowNs();
+        m_events.clear();
+
+        if (m_inputSource) {
+            // Kuyruktaki her olay ayri islenir, kenarlar birlesmez; basili kalanlar Hold alir.
+            bool touched[256] = { false };
+            size_t pending = m_inputSource->GetKeyQueueDepth();
+            SyntheticKeyEvent evt;
+            while (pending-- > 0 && m_running && m_inputSource->PopKeyEvent(evt)) {
+                touched[evt.vk] = true;
+                anyEdge |= ProcessKey(evt.vk, evt.pressed, false, false, false, evt.timestampNs);
             }
-            else if (isCurrentlyPressed && wasPreviouslyPressed) {
-                KeyEvent evt{ vk, KeyState::Hold, shift, ctrl, alt };
-                m_keyHistory[vk].lastState = KeyState::Hold;
-                m_keyHistory[vk].currentHoldCount++;
-
-                std::string msg = "[Hold] " + GetKeyName(vk) + " (" + std::to_string(vk) + ") [Held " + std::to_string(m_keyHistory[vk].currentHoldCount) + "x]";
-                if (!m_silentMode) {
-                    m_logger->Log(msg);
-                }
-
-                auto it = m_handlers.find(vk);
-                //if (it != m_handlers2.end()) it->second(evt);
-                if (it != m_handlers.end()) {
-                    for (auto& handler : it->second)
-                        handler(evt);
-                }
+            for (int vk = 1; vk <= 254 && m_running; ++vk) {
+                if (m_keyState[vk] && !touched[vk])
+                    anyEdge |= ProcessKey(vk, true, false, false, false, scanTimeNs);
             }
-            else if (!isCurrentlyPressed && wasPreviouslyPressed) {
-                keyState[vk] = false;
-                KeyEvent evt{ vk, KeyState::Up, shift, ctrl, alt };
-                m_keyHistory[vk].isPressed = false;
-                m_keyHistory[vk].lastState = KeyState::Up;
-                m_keyHistory[vk].currentHoldCount = 0;
-                m_keyHistory[vk].lastReleasedTime = std::chrono::steady_clock::now();
-
-                std::string msg = "[Up  ] " + GetKeyName(vk) + " (" + std::to_string(vk) + ")";
-                if (!m_silentMode) {
-                    m_logger->Log(msg);
-                }
-
-                auto it = m_handlers.find(vk);
-                //if (it != m_handlers2.end()) it->second(evt);
-                if (it != m_handlers.end()) {
-                    for (auto& handler : it->second)
-                        handler(evt);
-                }
+        }
+        else {
+            for (int vk = 1; vk <= 254 && m_running; ++vk) {
+                SHORT state = GetAsyncKeyState(vk);
+                bool isCurrentlyPressed = (state & 0x8000) != 0;
+
+                bool shift = (GetAsyncKeyState(VK_SHIFT) & 0x8000);
+                bool ctrl  = (GetAsyncKeyState(VK_CONTROL) & 0x8000);
+                bool alt   = (GetAsyncKeyState(VK_MENU) & 0x8000);
+
+                anyEdge |= ProcessKey(vk, isCurrentlyPressed, shift, ctrl, alt, scanTimeNs);
             }
         }
-        std::this_thread::sleep_for(std::chrono::milliseconds(30));
+        DispatchEvents();
+        JL_METRICS_CALL(m_metrics.OnPoll(ListenerMetricsClock::Ticks() - pollBegin, anyEdge));
+        JL_TRACE_SPAN_END(scanSpan);
+        m_pacer.Wait();
     }
 
-    if (!m_silentMode) {
-        m_logger->Log("[CKeyboardListener] Dinleme durduruldu.");
+    JL_LOG_INFO(m_logLevels, LogCategory::Lifecycle, m_logger->Log("[CKeyboardListener] Dinleme durduruldu."));
+}
+
+// Tek tusun yeni durumunu isler; Down veya Up kenari olduysa true doner.
+bool CKeyboardListener::ProcessKey(int vk, bool isCurrentlyPressed, bool shift, bool ctrl, bool alt, int64_t timestampNs) {
+    bool wasPreviouslyPressed = m_keyState[vk];
+    bool edge = false;
+    const uint16_t code = static_cast<uint16_t>(vk |
+        (shift ? InputEvent::ModShift : 0) | (ctrl ? InputEvent::ModCtrl : 0) | (alt ? InputEvent::ModAlt : 0));
+
+    KeyHistory& hist = m_keyHistory[vk];
+    m_keyHistoryUsed[vk] = true;
+    hist.wasPressed  = hist.isPressed;
+    hist.wasReleased = hist.isReleased;
+    hist.isPressed   = isCurrentlyPressed;
+    hist.isReleased  = !isCurrentlyPressed;
+
+    if (isCurrentlyPressed && !wasPreviouslyPressed) {
+        m_keyState[vk] = true;
+        m_keyHistory[vk].pressCount++;
+        m_keyHistory[vk].currentHoldCount = 1;
+        //m_keyHistory[vk].isPressed = true;
+        m_keyHistory[vk].lastState = KeyState::Down;
+        m_keyHistory[vk].lastPressedTime = std::chrono::steady_clock::now();
+
+        JL_LOG_INFO(m_logLevels, LogCategory::Key,
+            const std::string_view name = KeyNames::KeyName(vk);
+            AppendLog("[Down] %.*s (%d)", static_cast<int>(name.size()), name.data(), vk));
+        edge = true;
+        JL_METRICS_CALL(m_metrics.AddEvent(ListenerEventKind::KeyDown));
+        m_events.push_back(InputEvent::Make(timestampNs, m_deviceId, InputEventKind::KeyDown, code, 1.0f));                    
+        if (vk == VK_ESCAPE) {
+            JL_LOG_INFO(m_logLevels, LogCategory::Lifecycle, AppendLog("[CKeyboardListener] ESC algilandi, cikiliyor."));
+            m_running = false;
+        }
     }
+    else if (isCurrentlyPressed && wasPreviouslyPressed) {
+        m_keyHistory[vk].lastState = KeyState::Hold;
+        m_keyHistory[vk].currentHoldCount++;
+
+        // Ilk Hold satiri yazilir, sonrasi aralik basina bir ozet
+        JL_LOG_TRACE(m_logLevels, LogCategory::KeyHold,
+            LogRateSummary rate;
+            char rateText[64];
+            const std::string_view name = KeyNames::KeyName(vk);
+            if (m_logRate.Check(LogCategory::KeyHold, static_cast<uint16_t>(vk), timestampNs, rate))
+                AppendLog("[Hold] %.*s (%d) [Held %dx%s]", static_cast<int>(name.size()), name.data(), vk,
+                    m_keyHistory[vk].currentHoldCount, rate.Format(rateText, sizeof(rateText))));
+
+        JL_METRICS_CALL(m_metrics.AddEvent(ListenerEventKind::KeyHold));
+        m_events.push_back(InputEvent::Make(timestampNs, m_deviceId, InputEventKind::KeyHold, code, static_cast<float>(m_keyHistory[vk].currentHoldCount)));
+    }
+    else if (!isCurrentlyPressed && wasPreviouslyPressed) {
+        m_keyState[vk] = false;
+        m_keyHistory[vk].isPressed = false;
+        m_keyHistory[vk].lastState = KeyState::Up;
+        m_keyHistory[vk].currentHoldCount = 0;
+        m_keyHistory[vk].lastReleasedTime = std::chrono::steady_clock::now();
+
+        JL_LOG_TRACE(m_logLevels, LogCategory::KeyHold,
+            LogRateSummary rate;
+            char rateText[64];
+            const std::string_view name = KeyNames::KeyName(vk);
+            if (m_logRate.End(LogCategory::KeyHold, static_cast<uint16_t>(vk), timestampNs, rate))
+                AppendLog("[Hold] %.*s (%d) released%s", static_cast<int>(name.size()), name.data(), vk,
+                    rate.Format(rateText, sizeof(rateText))));
+        JL_LOG_INFO(m_logLevels, LogCategory::Key,
+            const std::string_view name = KeyNames::KeyName(vk);
+            AppendLog("[Up  ] %.*s (%d)", static_cast<int>(name.size()), name.data(), vk));
+
+        edge = true;
+        JL_METRICS_CALL(m_metrics.AddEvent(ListenerEventKind::KeyUp));
+        m_events.push_back(InputEvent::Make(timestampNs, m_deviceId, InputEventKind::KeyUp, code, 0.0f));
+    }
+
+    return edge;
+}
+
+// Once batch handler, ardindan RegisterHandler ile kaydedilen KeyEvent handler'lari (adapter).
+void CKeyboardListener::DispatchEvents() {
+    FlushLog();
+
+    if (m_events.empty())
+        return;
+
+    if (m_batchHandler) {
+        JL_TRACE_SCOPE("BatchHandler");
+        JL_METRICS_TIME_HANDLER(m_metrics, m_batchHandler(std::span<const InputEvent>(m_events.data(), m_events.size())));
+    }
+
+    for (const InputEvent& e : m_events) {
+        auto it = m_handlers.find(e.KeyCode());
+        if (it == m_handlers.end())
+            continue;
+
+        KeyState state = e.kind == InputEventKind::KeyDown ? KeyState::Down :
+                         e.kind == InputEventKind::KeyHold ? KeyState::Hold : KeyState::Up;
+        KeyEvent evt{ e.KeyCode(), state,
+            e.HasModifier(InputEvent::ModShift), e.HasModifier(InputEvent::ModCtrl), e.HasModifier(InputEvent::ModAlt) };
+
+        for (auto& handler : it->second) {
+            JL_TRACE_SCOPE("KeyHandler");
+            JL_METRICS_TIME_HANDLER(m_metrics, handler(evt));
+        }
+    }
+}
+
+void CKeyboardListener::FlushLog() {
+    if (m_logViews.empty())
+        return;
+
+    JL_TRACE_SCOPE("Log");
+    m_logger->LogBatch(std::span<const std::string_view>(m_logViews.data(), m_logViews.size()));
+    m_logViews.clear();
+    m_logUsed = 0;
+}
+
+// Satiri tampona yazar; tampon veya view listesi dolacaksa once bosaltir. MaxLogLine'i asan satir kesilir.
+void CKeyboardListener::AppendLog(const char* format, ...) {
+    if (sizeof(m_logBuffer) - m_logUsed < MaxLogLine || m_logViews.size() == m_logViews.capacity())
+        FlushLog();
+
+    va_list args;
+    va_start(args, format);
+    const int length = vsnprintf(m_logBuffer + m_logUsed, MaxLogLine, format, args);
+    va_end(args);
+    if (length <= 0)
+        return;
+
+    const size_t used = std::min<size_t>(static_cast<size_t>(length), MaxLogLine - 1);
+    m_logViews.emplace_back(m_logBuffer + m_logUsed, used);
+    m_logUsed += used;
 }
 
 void CKeyboardListener::SetSilentMode(bool silentMode) {
-    m_silentMode = silentMode;
+    m_logLevels.SetAll(silentMode ? LogLevel::Off : LogLevel::Trace);
+}
+
+void CKeyboardListener::SetLogLevel(LogCategory category, LogLevel level) {
+    m_logLevels.SetLevel(category, level);
+}
+
+void CKeyboardListener::SetLogRateInterval(std::chrono::milliseconds interval) {
+    m_logRate.SetInterval(std::chrono::duration_cast<std::chrono::nanoseconds>(interval).count());
+}
+
+const CLogRateLimiter& CKeyboardListener::GetLogRateLimiter() const {
+    return m_logRate;
+}
+
+const CListenerMetrics& CKeyboardListener::GetMetrics() const {
+    return m_metrics;
+}
+
+ListenerMetricsSnapshot CKeyboardListener::GetMetricsSnapshot() const {
+    return m_metrics.Snapshot();
+}
+
+void CKeyboardListener::SetPollPeriod(std::chrono::microseconds period, std::chrono::microseconds spinWindow) {
+    m_pacer.SetPeriod(period);
+    m_pacer.SetSpinWindow(spinWindow);
+}
+
+PacerStats CKeyboardListener::GetPacerStats() const {
+    return m_pacer.GetStats();
+}
+
+void CKeyboardListener::SetThreadConfig(const ThreadConfig& config) {
+    m_threadConfig = config;
+}
+
+ThreadConfigResult CKeyboardListener::GetThreadConfigResult() const {
+    return m_threadConfigResult;
+}
+
+void CKeyboardListener::SetInputSource(CSyntheticInputSource* source) {
+    m_inputSource = source;
+}
+
+void CKeyboardListener::SetBatchHandler(InputBatchHandler handler) {
+    m_batchHandler = handler;
+}
+
+void CKeyboardListener::SetDeviceId(uint8_t deviceId) {
+    m_deviceId = deviceId;
 }
\ No newline at end of file
@@ -8,10 +8,18 @@
 #include <memory>
 #include <functional>
 #include <unordered_map>
+#include <vector>
 
 #include "ILogger.h"
+#include "LogLevel.h"
+#include "LogRateLimiter.h"
 #include "KeyEvent.h"
 #include "KeyHistory.h"
+#include "ListenerMetrics.h"
+#include "LoopPacer.h"
+#include "ThreadConfig.h"
+#include "SyntheticInputSource.h"
+#include "InputEvent.h"
 
 class CKeyboardListener {
 public:
@@ -25,6 +33,10 @@ public:
     void SetLogger(std::shared_ptr<ILogger> logger);
     void RegisterHandler(int vk, std::function<void(const KeyEvent&)> handler);
 
+    // Bir taramadaki tum tus olaylari tek span olarak; RegisterHandler handler'lari bunun uzerinden beslenir.
+    void SetBatchHandler(InputBatchHandler handler);
+    void SetDeviceId(uint8_t deviceId);
+
     void ClearKeyHistory();
     const std::unordered_map<int, KeyHistory> GetKeyHistory() const;
     std::unordered_map<int, KeyHistory> GetKeyHistoryCopy() const;
@@ -34,8 +46,31 @@ public:
     bool IsInit() const;
     void SetSilentMode(bool silentMode);
 
+    // Kategori basina seviye (varsayilan Trace); JL_LOG_MIN_LEVEL altindaki seviyeler derlenmez.
+    void SetLogLevel(LogCategory category, LogLevel level);
+
+    // Basili tus satirlari: ilk olay ve aralik basina bir ozet (0: her tarama)
+    void SetLogRateInterval(std::chrono::milliseconds interval);
+    const CLogRateLimiter& GetLogRateLimiter() const;
+
+    const CListenerMetrics& GetMetrics() const;
+    ListenerMetricsSnapshot GetMetricsSnapshot() const;
+
+    void SetPollPeriod(std::chrono::microseconds period, std::chrono::microseconds spinWindow = std::chrono::microseconds(0));
+    PacerStats GetPacerStats() const;
+
+    void SetThreadConfig(const ThreadConfig& config);
+    ThreadConfigResult GetThreadConfigResult() const;
+
+    // GetAsyncKeyState yerine sentetik kaynaktan tus olaylari (stres testi).
+    void SetInputSource(CSyntheticInputSource* source);
+
 private:
     void ListenLoop();
+    bool ProcessKey(int vk, bool isCurrentlyPressed, bool shift, bool ctrl, bool alt, int64_t timestampNs);
+    void DispatchEvents();
+    void FlushLog();
+    void AppendLog(const char* format, ...);
 
     std::thread m_thread;
     std::atomic<bool> m_running;
@@ -43,6 +78,22 @@ private:
     std::shared_ptr<ILogger> m_logger;
     std::unordered_map<int, std::vector<std::function<void(const KeyEvent&)>>> m_handlers;
     std::unordered_map<int, std::function<void(const KeyEvent&)>> m_handlers2;
-    std::unordered_map<int, KeyHistory> m_keyHistory;
-    bool m_silentMode;
+    KeyHistory m_keyHistory[256];
+    bool m_keyHistoryUsed[256];                     // GetKeyHistory yalnizca gorulen tuslari dondurur
+    CLogLevels m_logLevels;
+    CLogRateLimiter m_logRate;
+    CListenerMetrics m_metrics;
+    CLoopPacer m_pacer;
+    ThreadConfig m_threadConfig;
+    ThreadConfigResult m_threadConfigResult;
+    bool m_keyState[256];
+    CSyntheticInputSource* m_inputSource;
+    InputBatchHandler m_batchHandler;
+    uint8_t m_deviceId;
+    std::vector<InputEvent> m_events;
+    // Tarama boyunca biriken satirlar sabit tamponda tutulur, tek LogBatch ile yazilir (heap kullanilmaz)
+    static constexpr size_t MaxLogLine = 160;
+    char m_logBuffer[8192];
+    size_t m_logUsed;
+    std::vector<std::string_view> m_logViews;
 };
\ No newline at end of file
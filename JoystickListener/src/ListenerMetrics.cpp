@@ -0,0 +1,279 @@
+#include "ListenerMetrics.h"
+
+#include <sstream>
+#include <iomanip>
+
+namespace ListenerMetricsClock
+{
+    static double Calibrate(void)
+    {
+#if (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))) || defined(__x86_64__) || defined(__i386__)
+        auto wallStart = std::chrono::steady_clock::now();
+        uint64_t tickStart = Ticks();
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        auto wallEnd = std::chrono::steady_clock::now();
+        uint64_t tickEnd = Ticks();
+
+        double ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(wallEnd - wallStart).count());
+        double ticks = static_cast<double>(tickEnd - tickStart);
+        return ticks > 0.0 ? ns / ticks : 1.0;
+#else
+        return 1e9 * std::chrono::steady_clock::period::num / std::chrono::steady_clock::period::den;
+#endif
+    }
+
+    double NsPerTick(void)
+    {
+        static const double nsPerTick = Calibrate();
+        return nsPerTick;
+    }
+}
+
+const char* ListenerEventKindName(ListenerEventKind kind)
+{
+    switch (kind)
+    {
+        case ListenerEventKind::ButtonEdge: return "ButtonEdge";
+        case ListenerEventKind::ButtonHeld: return "ButtonHeld";
+        case ListenerEventKind::Axis:       return "Axis";
+        case ListenerEventKind::KeyDown:    return "KeyDown";
+        case ListenerEventKind::KeyHold:    return "KeyHold";
+        case ListenerEventKind::KeyUp:      return "KeyUp";
+        default:                            return "Unknown";
+    }
+}
+
+double HistogramSnapshot::Percentile(double p) const
+{
+    if (count == 0)
+        return 0.0;
+
+    uint64_t target = static_cast<uint64_t>(p * static_cast<double>(count));
+    if (target >= count)
+        target = count - 1;
+
+    uint64_t seen = 0;
+    for (int b = 0; b < BucketCount; ++b)
+    {
+        seen += buckets[b];
+        if (seen > target)
+        {
+            double upperTicks = (b >= 63) ? 18446744073709551615.0 : static_cast<double>((uint64_t(1) << (b + 1)) - 1);
+            double upperNs = upperTicks * nsPerTick;
+            return upperNs < maxNs ? upperNs : maxNs;
+        }
+    }
+    return maxNs;
+}
+
+CLatencyHistogram::CLatencyHistogram()
+    : m_count(0), m_sumTicks(0), m_maxTicks(0)
+{
+    for (auto& bucket : m_buckets)
+        bucket.store(0, std::memory_order_relaxed);
+}
+
+void CLatencyHistogram::Read(HistogramSnapshot& out, double nsPerTick) const
+{
+    out.nsPerTick = nsPerTick;
+    out.count = m_count.load(std::memory_order_relaxed);
+    for (int b = 0; b < HistogramSnapshot::BucketCount; ++b)
+        out.buckets[b] = m_buckets[b].load(std::memory_order_relaxed);
+
+    uint64_t sum = m_sumTicks.load(std::memory_order_relaxed);
+    out.meanNs = out.count ? (static_cast<double>(sum) / out.count) * nsPerTick : 0.0;
+    out.maxNs = static_cast<double>(m_maxTicks.load(std::memory_order_relaxed)) * nsPerTick;
+}
+
+CListenerMetrics::CListenerMetrics(const char* name)
+    : m_name(name ? name : ""),
+    m_polls(0),
+    m_emptyPolls(0),
+    m_acquireErrors(0),
+    m_reacquireAttempts(0)
+{
+    for (auto& counter : m_events)
+        counter.store(0, std::memory_order_relaxed);
+
+#if JL_METRICS_ENABLED
+    // Kalibrasyonu ilk snapshot yerine burada yap.
+    ListenerMetricsClock::NsPerTick();
+#endif
+}
+
+ListenerMetricsSnapshot CListenerMetrics::Snapshot(void) const
+{
+    ListenerMetricsSnapshot snap;
+    snap.name = m_name;
+    snap.polls = m_polls.load(std::memory_order_relaxed);
+    snap.emptyPolls = m_emptyPolls.load(std::memory_order_relaxed);
+    snap.acquireErrors = m_acquireErrors.load(std::memory_order_relaxed);
+    snap.reacquireAttempts = m_reacquireAttempts.load(std::memory_order_relaxed);
+    for (int i = 0; i < static_cast<int>(ListenerEventKind::Count); ++i)
+        snap.events[i] = m_events[i].load(std::memory_order_relaxed);
+
+    double nsPerTick = ListenerMetricsClock::NsPerTick();
+    m_pollDuration.Read(snap.pollDuration, nsPerTick);
+    m_handlerTime.Read(snap.handlerTime, nsPerTick);
+    return snap;
+}
+
+static void PrintHistogram(std::ostream& os, const char* label, const HistogramSnapshot& h)
+{
+    os << "  " << std::left << std::setw(14) << label << std::right
+       << " n : "    << std::setw(8) << h.count
+       << "  mean : " << std::setw(9) << std::fixed << std::setprecision(0) << h.meanNs << " ns"
+       << "  p50 : "  << std::setw(9) << h.Percentile(0.50) << " ns"
+       << "  p99 : "  << std::setw(9) << h.Percentile(0.99) << " ns"
+       << "  max : "  << std::setw(9) << h.maxNs << " ns\n";
+}
+
+void ListenerMetricsSnapshot::Print(std::ostream& os) const
+{
+    os << "[Metrics] " << name << "\n";
+    os << "  polls : " << polls
+       << "  empty : " << emptyPolls
+       << "  acquireErrors : " << acquireErrors
+       << "  reacquireAttempts : " << reacquireAttempts << "\n";
+    os << "  events :";
+    for (int i = 0; i < static_cast<int>(ListenerEventKind::Count); ++i)
+        os << "  " << ListenerEventKindName(static_cast<ListenerEventKind>(i)) << " : " << events[i];
+    os << "\n";
+    PrintHistogram(os, "pollDuration", pollDuration);
+    PrintHistogram(os, "handlerTime", handlerTime);
+}
+
+std::string ListenerMetricsSnapshot::ToString(void) const
+{
+    std::stringstream ss;
+    Print(ss);
+    return ss.str();
+}
+
+template<typename T>
+static void WritePod(std::ostream& os, const T& value)
+{
+    os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+static void WriteHistogram(std::ostream& os, const HistogramSnapshot& h)
+{
+    WritePod(os, h.count);
+    WritePod(os, h.meanNs);
+    WritePod(os, h.maxNs);
+    WritePod(os, h.nsPerTick);
+    os.write(reinterpret_cast<const char*>(h.buckets), sizeof(h.buckets));
+}
+
+// Kayit: "JLMT" | uint32 version | int64 unix ms | uint32 nameLen | name |
+//        4 x uint64 sayac | uint32 eventCount | eventCount x uint64 | 2 x histogram
+void ListenerMetricsSnapshot::WriteBinary(std::ostream& os) const
+{
+    const char magic[4] = { 'J', 'L', 'M', 'T' };
+    const uint32_t version = 1;
+    const int64_t unixMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    const uint32_t nameLen = static_cast<uint32_t>(name.size());
+    const uint32_t eventCount = static_cast<uint32_t>(ListenerEventKind::Count);
+
+    os.write(magic, sizeof(magic));
+    WritePod(os, version);
+    WritePod(os, unixMs);
+    WritePod(os, nameLen);
+    os.write(name.data(), nameLen);
+    WritePod(os, polls);
+    WritePod(os, emptyPolls);
+    WritePod(os, acquireErrors);
+    WritePod(os, reacquireAttempts);
+    WritePod(os, eventCount);
+    os.write(reinterpret_cast<const char*>(events), sizeof(events));
+    WriteHistogram(os, pollDuration);
+    WriteHistogram(os, handlerTime);
+}
+
+CMetricsDumper::CMetricsDumper()
+    : m_interval(std::chrono::milliseconds(1000)),
+    m_running(false)
+{
+}
+
+CMetricsDumper::~CMetricsDumper()
+{
+    Stop();
+}
+
+void CMetricsDumper::AddSource(const CListenerMetrics* metrics)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (metrics)
+        m_sources.push_back(metrics);
+}
+
+void CMetricsDumper::SetTextLogger(std::shared_ptr<ILogger> logger)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_logger = logger;
+}
+
+bool CMetricsDumper::SetBinaryFile(const std::string& filename)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_binaryFile.open(filename, std::ios::binary | std::ios::app);
+    return m_binaryFile.is_open();
+}
+
+void CMetricsDumper::SetInterval(std::chrono::milliseconds interval)
+{
+    // DumpLoop m_interval'i m_mutex altinda okur
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_interval = interval;
+}
+
+void CMetricsDumper::Start(void)
+{
+    if (m_running.exchange(true))
+        return;
+    m_thread = std::thread(&CMetricsDumper::DumpLoop, this);
+}
+
+void CMetricsDumper::Stop(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_running.exchange(false))
+            return;
+    }
+    m_cv.notify_all();
+    if (m_thread.joinable())
+        m_thread.join();
+}
+
+void CMetricsDumper::DumpNow(void)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const CListenerMetrics* source : m_sources)
+    {
+        ListenerMetricsSnapshot snap = source->Snapshot();
+        if (m_logger)
+            m_logger->Log(snap.ToString());
+        if (m_binaryFile.is_open())
+            snap.WriteBinary(m_binaryFile);
+    }
+    if (m_binaryFile.is_open())
+        m_binaryFile.flush();
+}
+
+void CMetricsDumper::DumpLoop(void)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (m_running)
+    {
+        m_cv.wait_for(lock, m_interval, [this] { return !m_running; });
+        if (!m_running)
+            break;
+
+        lock.unlock();
+        DumpNow();
+        lock.lock();
+    }
+}
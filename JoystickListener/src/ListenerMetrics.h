@@ -0,0 +1,220 @@
+#pragma once
+
+#include <cstdint>
+#include <atomic>
+#include <string>
+#include <iostream>
+#include <fstream>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <vector>
+#include <memory>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "ILogger.h"
+
+// JL_METRICS_ENABLED=0 derlemede tum olcum noktalarini kaldirir.
+#ifndef JL_METRICS_ENABLED
+#define JL_METRICS_ENABLED 1
+#endif
+
+namespace ListenerMetricsClock
+{
+    inline uint64_t Ticks(void)
+    {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        return __rdtsc();
+#elif defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+    }
+
+    // Tick -> nanosaniye katsayisi, ilk cagrida bir kez kalibre edilir.
+    double NsPerTick(void);
+}
+
+#if JL_METRICS_ENABLED
+#define JL_METRICS_TICKS(var) const uint64_t var = ListenerMetricsClock::Ticks()
+#define JL_METRICS_CALL(expr) expr
+#define JL_METRICS_TIME_HANDLER(metrics, ...) \
+    do { const uint64_t jlHandlerT0_ = ListenerMetricsClock::Ticks(); __VA_ARGS__; \
+         (metrics).AddHandlerTime(ListenerMetricsClock::Ticks() - jlHandlerT0_); } while (0)
+#else
+#define JL_METRICS_TICKS(var) ((void)0)
+#define JL_METRICS_CALL(expr) ((void)0)
+#define JL_METRICS_TIME_HANDLER(metrics, ...) do { __VA_ARGS__; } while (0)
+#endif
+
+enum class ListenerEventKind : int
+{
+    ButtonEdge = 0,
+    ButtonHeld,
+    Axis,
+    KeyDown,
+    KeyHold,
+    KeyUp,
+    Count
+};
+
+const char* ListenerEventKindName(ListenerEventKind kind);
+
+struct HistogramSnapshot
+{
+    static const int BucketCount = 64;
+
+    uint64_t count = 0;
+    double   meanNs = 0.0;
+    double   maxNs = 0.0;
+    double   nsPerTick = 1.0;
+    uint64_t buckets[BucketCount] = {};
+
+    // Bucket ust sinirina gore yaklasik yuzdelik (ns).
+    double Percentile(double p) const;
+};
+
+struct ListenerMetricsSnapshot
+{
+    std::string name;
+    uint64_t polls = 0;
+    uint64_t emptyPolls = 0;
+    uint64_t acquireErrors = 0;
+    uint64_t reacquireAttempts = 0;
+    uint64_t events[static_cast<int>(ListenerEventKind::Count)] = {};
+    HistogramSnapshot pollDuration;
+    HistogramSnapshot handlerTime;
+
+    void Print(std::ostream& os) const;
+    std::string ToString(void) const;
+    void WriteBinary(std::ostream& os) const;
+};
+
+// Log2 bucket'li histogram. Tek yazar (listener thread), cok okuyucu.
+class CLatencyHistogram
+{
+public:
+    CLatencyHistogram();
+
+    void Record(uint64_t ticks)
+    {
+        Bump(m_buckets[BucketOf(ticks)]);
+        Bump(m_count);
+        m_sumTicks.store(m_sumTicks.load(std::memory_order_relaxed) + ticks, std::memory_order_relaxed);
+        if (ticks > m_maxTicks.load(std::memory_order_relaxed))
+            m_maxTicks.store(ticks, std::memory_order_relaxed);
+    }
+
+    void Read(HistogramSnapshot& out, double nsPerTick) const;
+
+private:
+    static void Bump(std::atomic<uint64_t>& counter)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    static int BucketOf(uint64_t v)
+    {
+        if (v == 0)
+            return 0;
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+        unsigned long idx;
+        _BitScanReverse64(&idx, v);
+        return static_cast<int>(idx);
+#elif defined(_MSC_VER)
+        unsigned long idx;
+        if (_BitScanReverse(&idx, static_cast<unsigned long>(v >> 32)))
+            return static_cast<int>(idx) + 32;
+        _BitScanReverse(&idx, static_cast<unsigned long>(v));
+        return static_cast<int>(idx);
+#else
+        return 63 - __builtin_clzll(v);
+#endif
+    }
+
+    std::atomic<uint64_t> m_buckets[HistogramSnapshot::BucketCount];
+    std::atomic<uint64_t> m_count;
+    std::atomic<uint64_t> m_sumTicks;
+    std::atomic<uint64_t> m_maxTicks;
+};
+
+// Listener thread'ine ait sayaclar. Her listener kendi ornegini tutar,
+// boylece yazma tarafi tek thread'dir ve atomik RMW gerekmez.
+class alignas(64) CListenerMetrics
+{
+public:
+    explicit CListenerMetrics(const char* name);
+
+    void OnPoll(uint64_t durationTicks, bool changed)
+    {
+        Bump(m_polls);
+        if (!changed)
+            Bump(m_emptyPolls);
+        m_pollDuration.Record(durationTicks);
+    }
+
+    void AddEvent(ListenerEventKind kind)
+    {
+        Bump(m_events[static_cast<int>(kind)]);
+    }
+
+    void AddHandlerTime(uint64_t ticks)        { m_handlerTime.Record(ticks);  }
+    void AddAcquireError(void)                 { Bump(m_acquireErrors);        }
+    void AddReacquireAttempt(void)             { Bump(m_reacquireAttempts);    }
+
+    ListenerMetricsSnapshot Snapshot(void) const;
+    const std::string& GetName(void) const     { return m_name;                }
+
+private:
+    static void Bump(std::atomic<uint64_t>& counter)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    std::string m_name;
+    std::atomic<uint64_t> m_polls;
+    std::atomic<uint64_t> m_emptyPolls;
+    std::atomic<uint64_t> m_acquireErrors;
+    std::atomic<uint64_t> m_reacquireAttempts;
+    std::atomic<uint64_t> m_events[static_cast<int>(ListenerEventKind::Count)];
+    CLatencyHistogram m_pollDuration;
+    CLatencyHistogram m_handlerTime;
+};
+
+// Kayitli metrik kaynaklarini belirli araliklarla metin (ILogger) veya
+// ikili dosya olarak doker.
+class CMetricsDumper
+{
+public:
+    CMetricsDumper();
+    ~CMetricsDumper();
+
+    void AddSource(const CListenerMetrics* metrics);
+    void SetTextLogger(std::shared_ptr<ILogger> logger);
+    bool SetBinaryFile(const std::string& filename);
+    void SetInterval(std::chrono::milliseconds interval);
+
+    void Start(void);
+    void Stop(void);
+    void DumpNow(void);
+
+private:
+    void DumpLoop(void);
+
+    std::vector<const CListenerMetrics*> m_sources;
+    std::shared_ptr<ILogger> m_logger;
+    std::ofstream m_binaryFile;
+    std::chrono::milliseconds m_interval;
+
+    std::thread m_thread;
+    std::atomic<bool> m_running;
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+};
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "TraceRecorder.h"
+
+#define JL_LOG_LEVEL_TRACE 0
+#define JL_LOG_LEVEL_DEBUG 1
+#define JL_LOG_LEVEL_INFO  2
+#define JL_LOG_LEVEL_WARN  3
+#define JL_LOG_LEVEL_ERROR 4
+#define JL_LOG_LEVEL_OFF   5
+
+// Derleme zamani alt sinir; altindaki JL_LOG_* cagrilari koddan tamamen cikar.
+// Orn. /DJL_LOG_MIN_LEVEL=2 ile Trace/Debug (eksen, hold) loglari derlenmez.
+#ifndef JL_LOG_MIN_LEVEL
+#define JL_LOG_MIN_LEVEL JL_LOG_LEVEL_TRACE
+#endif
+
+enum class LogLevel : uint8_t
+{
+    Trace = JL_LOG_LEVEL_TRACE,
+    Debug = JL_LOG_LEVEL_DEBUG,
+    Info  = JL_LOG_LEVEL_INFO,
+    Warn  = JL_LOG_LEVEL_WARN,
+    Error = JL_LOG_LEVEL_ERROR,
+    Off   = JL_LOG_LEVEL_OFF
+};
+
+enum class LogCategory : uint8_t
+{
+    Lifecycle = 0,  // init, start/stop, hata
+    Axis,
+    Button,
+    ButtonHeld,
+    Key,
+    KeyHold,
+    Count
+};
+
+inline const char* LogLevelName(LogLevel level)
+{
+    static const char* names[] = { "Trace", "Debug", "Info", "Warn", "Error", "Off" };
+    const int i = static_cast<int>(level);
+    return i >= 0 && i <= JL_LOG_LEVEL_OFF ? names[i] : "?";
+}
+
+inline const char* LogCategoryName(LogCategory category)
+{
+    static const char* names[] = { "Lifecycle", "Axis", "Button", "ButtonHeld", "Key", "KeyHold" };
+    const int i = static_cast<int>(category);
+    return i >= 0 && i < static_cast<int>(LogCategory::Count) ? names[i] : "?";
+}
+
+// Kategori basina calisma zamani seviyesi; her thread'den ayarlanabilir/okunabilir.
+class CLogLevels
+{
+public:
+    explicit CLogLevels(LogLevel level = LogLevel::Info)
+    {
+        SetAll(level);
+    }
+
+    void SetLevel(LogCategory category, LogLevel level)
+    {
+        m_levels[static_cast<int>(category)].store(static_cast<uint8_t>(level), std::memory_order_relaxed);
+    }
+
+    LogLevel GetLevel(LogCategory category) const
+    {
+        return static_cast<LogLevel>(m_levels[static_cast<int>(category)].load(std::memory_order_relaxed));
+    }
+
+    void SetAll(LogLevel level)
+    {
+        for (int c = 0; c < static_cast<int>(LogCategory::Count); ++c)
+            m_levels[c].store(static_cast<uint8_t>(level), std::memory_order_relaxed);
+    }
+
+    bool IsEnabled(LogCategory category, LogLevel level) const
+    {
+        return static_cast<uint8_t>(level) >= m_levels[static_cast<int>(category)].load(std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<uint8_t> m_levels[static_cast<int>(LogCategory::Count)];
+};
+
+// Mesaj sadece seviye kontrolu gectikten sonra olusturulur:
+//   JL_LOG_INFO(m_logLevels, LogCategory::Button, (*m_logger) << "[Button] " << id << "\n");
+#define JL_LOG_AT(levels, category, level, ...) \
+    do { if ((levels).IsEnabled(category, level)) { JL_TRACE_SCOPE("Log"); __VA_ARGS__; } } while (0)
+
+#define JL_LOG_DISABLED(...) ((void)0)
+
+#if JL_LOG_MIN_LEVEL <= JL_LOG_LEVEL_TRACE
+#define JL_LOG_TRACE(levels, category, ...) JL_LOG_AT(levels, category, LogLevel::Trace, __VA_ARGS__)
+#else
+#define JL_LOG_TRACE(levels, category, ...) JL_LOG_DISABLED()
+#endif
+
+#if JL_LOG_MIN_LEVEL <= JL_LOG_LEVEL_DEBUG
+#define JL_LOG_DEBUG(levels, category, ...) JL_LOG_AT(levels, category, LogLevel::Debug, __VA_ARGS__)
+#else
+#define JL_LOG_DEBUG(levels, category, ...) JL_LOG_DISABLED()
+#endif
+
+#if JL_LOG_MIN_LEVEL <= JL_LOG_LEVEL_INFO
+#define JL_LOG_INFO(levels, category, ...) JL_LOG_AT(levels, category, LogLevel::Info, __VA_ARGS__)
+#else
+#define JL_LOG_INFO(levels, category, ...) JL_LOG_DISABLED()
+#endif
+
+#if JL_LOG_MIN_LEVEL <= JL_LOG_LEVEL_WARN
+#define JL_LOG_WARN(levels, category, ...) JL_LOG_AT(levels, category, LogLevel::Warn, __VA_ARGS__)
+#else
+#define JL_LOG_WARN(levels, category, ...) JL_LOG_DISABLED()
+#endif
+
+#if JL_LOG_MIN_LEVEL <= JL_LOG_LEVEL_ERROR
+#define JL_LOG_ERROR(levels, category, ...) JL_LOG_AT(levels, category, LogLevel::Error, __VA_ARGS__)
+#else
+#define JL_LOG_ERROR(levels, category, ...) JL_LOG_DISABLED()
+#endif
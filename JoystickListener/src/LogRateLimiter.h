@@ -0,0 +1,139 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#include "LogLevel.h"
+
+// Bastirilan tekrarlar; Format/ToString ozet satirina eklenecek kismi verir.
+struct LogRateSummary
+{
+    bool     first = false;         // serinin ilk olayi
+    uint32_t suppressed = 0;        // son yazilan satirdan beri yazilmayan olay sayisi
+    int64_t  durationNs = 0;        // serinin basindan beri gecen sure
+
+    // Ayirma yapmaz; bastirma yoksa bos string
+    const char* Format(char* buffer, size_t size) const
+    {
+        if (size == 0)
+            return buffer;
+        buffer[0] = '\0';
+        if (suppressed != 0)
+            snprintf(buffer, size, ", %u suppressed, %lld ms", suppressed, static_cast<long long>(durationNs / 1000000));
+        return buffer;
+    }
+
+    std::string ToString(void) const
+    {
+        char buffer[64];
+        return Format(buffer, sizeof(buffer));
+    }
+};
+
+// Kategori + kod (tus, buton) basina tekrar eden log satirlarini seyreltir: serinin ilk
+// olayi yazilir, sonra en fazla interval'de bir ozet satiri. Sayaclar tek yazici
+// (listener thread'i) icin relaxed atomiklerdir; bastirma birkac yukleme/yazmadir.
+class CLogRateLimiter
+{
+public:
+    static const int MaxCodes = 256;
+
+    explicit CLogRateLimiter(int64_t intervalNs = 1000000000)
+        : m_intervalNs(intervalNs)
+    {
+    }
+
+    // 0: sinirlama yok, her olay yazilir
+    void SetInterval(int64_t intervalNs)   { m_intervalNs.store(intervalNs, std::memory_order_relaxed);   }
+    int64_t GetInterval(void) const         { return m_intervalNs.load(std::memory_order_relaxed);        }
+
+    // Satir yazilacaksa true
+    bool Check(LogCategory category, uint16_t code, int64_t nowNs, LogRateSummary& summary)
+    {
+        if (code >= MaxCodes)
+            return true;
+
+        Slot& slot = m_slots[static_cast<int>(category)][code];
+        const int c = static_cast<int>(category);
+
+        if (!slot.active.load(std::memory_order_relaxed))
+        {
+            slot.active.store(true, std::memory_order_relaxed);
+            slot.streakStartNs.store(nowNs, std::memory_order_relaxed);
+            slot.lastEmitNs.store(nowNs, std::memory_order_relaxed);
+            slot.suppressed.store(0, std::memory_order_relaxed);
+            summary.first = true;
+            Bump(m_emitted[c]);
+            return true;
+        }
+
+        const int64_t interval = m_intervalNs.load(std::memory_order_relaxed);
+        if (interval <= 0 || nowNs - slot.lastEmitNs.load(std::memory_order_relaxed) >= interval)
+        {
+            summary.suppressed = slot.suppressed.load(std::memory_order_relaxed);
+            summary.durationNs = nowNs - slot.streakStartNs.load(std::memory_order_relaxed);
+            slot.suppressed.store(0, std::memory_order_relaxed);
+            slot.lastEmitNs.store(nowNs, std::memory_order_relaxed);
+            Bump(m_emitted[c]);
+            return true;
+        }
+
+        slot.suppressed.store(slot.suppressed.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        Bump(m_suppressed[c]);
+        return false;
+    }
+
+    // Seri bitti (tus/buton birakildi). Yazilmamis bastirilan olay varsa son ozet icin true.
+    bool End(LogCategory category, uint16_t code, int64_t nowNs, LogRateSummary& summary)
+    {
+        if (code >= MaxCodes)
+            return false;
+
+        Slot& slot = m_slots[static_cast<int>(category)][code];
+        if (!slot.active.load(std::memory_order_relaxed))
+            return false;
+
+        slot.active.store(false, std::memory_order_relaxed);
+        summary.suppressed = slot.suppressed.load(std::memory_order_relaxed);
+        summary.durationNs = nowNs - slot.streakStartNs.load(std::memory_order_relaxed);
+        slot.suppressed.store(0, std::memory_order_relaxed);
+        if (summary.suppressed == 0)
+            return false;
+
+        Bump(m_emitted[static_cast<int>(category)]);
+        return true;
+    }
+
+    uint64_t GetEmittedCount(LogCategory category) const
+    {
+        return m_emitted[static_cast<int>(category)].load(std::memory_order_relaxed);
+    }
+
+    uint64_t GetSuppressedCount(LogCategory category) const
+    {
+        return m_suppressed[static_cast<int>(category)].load(std::memory_order_relaxed);
+    }
+
+private:
+    struct Slot
+    {
+        std::atomic<bool>     active{ false };
+        std::atomic<uint32_t> suppressed{ 0 };
+        std::atomic<int64_t>  streakStartNs{ 0 };
+        std::atomic<int64_t>  lastEmitNs{ 0 };
+    };
+
+    static void Bump(std::atomic<uint64_t>& counter)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    static const int CategoryCount = static_cast<int>(LogCategory::Count);
+
+    std::atomic<int64_t> m_intervalNs;
+    Slot m_slots[CategoryCount][MaxCodes];
+    std::atomic<uint64_t> m_emitted[CategoryCount] = {};
+    std::atomic<uint64_t> m_suppressed[CategoryCount] = {};
+};
@@ -0,0 +1,232 @@
+#include "LoopPacer.h"
+
+#include <algorithm>
+#include <vector>
+#include <iomanip>
+#include <cerrno>
+
+#ifdef _WIN32
+#include <windows.h>
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+#else
+#include <time.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define JL_CPU_RELAX() _mm_pause()
+#elif defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define JL_CPU_RELAX() _mm_pause()
+#else
+#define JL_CPU_RELAX() ((void)0)
+#endif
+
+CLoopPacer::CLoopPacer(std::chrono::nanoseconds period, std::chrono::nanoseconds spinWindow)
+    : m_periodNs(std::max<int64_t>(period.count(), 0)),
+    m_spinNs(spinWindow.count()),
+    m_nextDeadlineNs(0),
+    m_lastWakeNs(0),
+    m_iterations(0),
+    m_missed(0)
+{
+    for (auto& p : m_periods)
+        p.store(0, std::memory_order_relaxed);
+
+#ifdef _WIN32
+    m_timer = CreateWaitableTimerExW(NULL, NULL, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+    if (!m_timer)
+        m_timer = CreateWaitableTimerExW(NULL, NULL, 0, TIMER_ALL_ACCESS);
+#endif
+
+    Reset();
+}
+
+CLoopPacer::~CLoopPacer()
+{
+#ifdef _WIN32
+    if (m_timer)
+        CloseHandle(m_timer);
+#endif
+}
+
+void CLoopPacer::SetPeriod(std::chrono::nanoseconds period)
+{
+    m_periodNs.store(std::max<int64_t>(period.count(), 0), std::memory_order_relaxed);
+}
+
+std::chrono::nanoseconds CLoopPacer::GetPeriod(void) const
+{
+    return std::chrono::nanoseconds(m_periodNs.load(std::memory_order_relaxed));
+}
+
+void CLoopPacer::SetSpinWindow(std::chrono::nanoseconds spinWindow)
+{
+    m_spinNs.store(spinWindow.count(), std::memory_order_relaxed);
+}
+
+void CLoopPacer::Reset(void)
+{
+    int64_t now = NowNs();
+    m_nextDeadlineNs = now + m_periodNs.load(std::memory_order_relaxed);
+    m_lastWakeNs = 0;
+}
+
+int64_t CLoopPacer::NowNs(void)
+{
+#ifdef _WIN32
+    static const int64_t frequency = [] {
+        LARGE_INTEGER f;
+        QueryPerformanceFrequency(&f);
+        return static_cast<int64_t>(f.QuadPart);
+    }();
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    int64_t c = static_cast<int64_t>(counter.QuadPart);
+    return (c / frequency) * 1000000000LL + ((c % frequency) * 1000000000LL) / frequency;
+#else
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+#endif
+}
+
+void CLoopPacer::SleepUntil(int64_t deadlineNs)
+{
+    const int64_t spinNs = m_spinNs.load(std::memory_order_relaxed);
+    const int64_t sleepUntilNs = deadlineNs - spinNs;
+
+#ifdef _WIN32
+    int64_t remaining = sleepUntilNs - NowNs();
+    if (remaining > 0)
+    {
+        if (m_timer)
+        {
+            LARGE_INTEGER due;
+            due.QuadPart = -(remaining / 100);   // goreli, 100 ns birim
+            if (due.QuadPart < 0 && SetWaitableTimer(m_timer, &due, 0, NULL, NULL, FALSE))
+                WaitForSingleObject(m_timer, INFINITE);
+        }
+        else
+        {
+            Sleep(static_cast<DWORD>(remaining / 1000000));
+        }
+    }
+#else
+    if (sleepUntilNs > NowNs())
+    {
+        timespec ts;
+        ts.tv_sec = static_cast<time_t>(sleepUntilNs / 1000000000LL);
+        ts.tv_nsec = static_cast<long>(sleepUntilNs % 1000000000LL);
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR)
+        {
+        }
+    }
+#endif
+
+    if (spinNs > 0)
+    {
+        while (NowNs() < deadlineNs)
+            JL_CPU_RELAX();
+    }
+}
+
+bool CLoopPacer::Wait(void)
+{
+    const int64_t periodNs = m_periodNs.load(std::memory_order_relaxed);
+    int64_t now = NowNs();
+    bool onTime = true;
+
+    if (periodNs == 0)
+    {
+        m_nextDeadlineNs = now;
+        RecordPeriod(now);
+        return true;
+    }
+
+    if (now >= m_nextDeadlineNs)
+    {
+        // Kacirilan slotlari atla, fazi koru.
+        onTime = false;
+        m_missed.store(m_missed.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        int64_t behind = now - m_nextDeadlineNs;
+        m_nextDeadlineNs += (behind / periodNs + 1) * periodNs;
+    }
+
+    SleepUntil(m_nextDeadlineNs);
+    m_nextDeadlineNs += periodNs;
+
+    RecordPeriod(NowNs());
+    return onTime;
+}
+
+void CLoopPacer::RecordPeriod(int64_t nowNs)
+{
+    uint64_t n = m_iterations.load(std::memory_order_relaxed);
+    if (m_lastWakeNs != 0)
+        m_periods[n % HistorySize].store(nowNs - m_lastWakeNs, std::memory_order_relaxed);
+    m_lastWakeNs = nowNs;
+    m_iterations.store(n + 1, std::memory_order_relaxed);
+}
+
+static double PercentileOf(std::vector<double>& values, double p)
+{
+    if (values.empty())
+        return 0.0;
+    size_t k = static_cast<size_t>(p * (values.size() - 1) + 0.5);
+    std::nth_element(values.begin(), values.begin() + k, values.end());
+    return values[k];
+}
+
+PacerStats CLoopPacer::GetStats(void) const
+{
+    PacerStats stats;
+    stats.iterations = m_iterations.load(std::memory_order_relaxed);
+    stats.missedDeadlines = m_missed.load(std::memory_order_relaxed);
+    stats.targetPeriodUs = m_periodNs.load(std::memory_order_relaxed) / 1000.0;
+
+    std::vector<double> periods;
+    periods.reserve(HistorySize);
+    for (const auto& p : m_periods)
+    {
+        int64_t v = p.load(std::memory_order_relaxed);
+        if (v > 0)
+            periods.push_back(v / 1000.0);
+    }
+    if (periods.empty())
+        return stats;
+
+    std::vector<double> jitter;
+    jitter.reserve(periods.size());
+    double sum = 0.0;
+    for (double v : periods)
+    {
+        sum += v;
+        jitter.push_back(v > stats.targetPeriodUs ? v - stats.targetPeriodUs : stats.targetPeriodUs - v);
+    }
+
+    stats.meanPeriodUs = sum / periods.size();
+    stats.maxPeriodUs = *std::max_element(periods.begin(), periods.end());
+    stats.maxJitterUs = *std::max_element(jitter.begin(), jitter.end());
+    stats.p50PeriodUs = PercentileOf(periods, 0.50);
+    stats.p99PeriodUs = PercentileOf(periods, 0.99);
+    stats.p50JitterUs = PercentileOf(jitter, 0.50);
+    stats.p90JitterUs = PercentileOf(jitter, 0.90);
+    stats.p99JitterUs = PercentileOf(jitter, 0.99);
+    return stats;
+}
+
+void PacerStats::Print(std::ostream& os, const char* name) const
+{
+    os << "[Pacer] " << name
+       << std::fixed << std::setprecision(1)
+       << "  target : " << targetPeriodUs << " us"
+       << "  iterations : " << iterations
+       << "  missed : " << missedDeadlines << "\n";
+    os << "  period  mean : " << meanPeriodUs << "  p50 : " << p50PeriodUs
+       << "  p99 : " << p99PeriodUs << "  max : " << maxPeriodUs << " us\n";
+    os << "  jitter  p50 : " << p50JitterUs << "  p90 : " << p90JitterUs
+       << "  p99 : " << p99JitterUs << "  max : " << maxJitterUs << " us\n";
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <iostream>
+
+struct PacerStats
+{
+    uint64_t iterations = 0;
+    uint64_t missedDeadlines = 0;
+    double targetPeriodUs = 0.0;
+
+    // Son orneklem penceresi uzerinden (us).
+    double meanPeriodUs = 0.0;
+    double p50PeriodUs = 0.0;
+    double p99PeriodUs = 0.0;
+    double maxPeriodUs = 0.0;
+
+    // |gerceklesen periyot - hedef periyot| (us).
+    double p50JitterUs = 0.0;
+    double p90JitterUs = 0.0;
+    double p99JitterUs = 0.0;
+    double maxJitterUs = 0.0;
+
+    void Print(std::ostream& os, const char* name = "") const;
+};
+
+// Mutlak deadline'lara uyuyarak sabit periyot saglar; is suresi degisse de
+// periyot kaymaz. Son spinWindow kadar sure mesgul bekleme ile gecirilir.
+// Periyot 0 (veya negatif) ise hiz sinirlanmaz; Wait beklemeden doner.
+class CLoopPacer
+{
+public:
+    static const int HistorySize = 1024;
+
+    explicit CLoopPacer(std::chrono::nanoseconds period = std::chrono::milliseconds(20),
+                        std::chrono::nanoseconds spinWindow = std::chrono::nanoseconds(0));
+    ~CLoopPacer();
+
+    CLoopPacer(const CLoopPacer&) = delete;
+    CLoopPacer& operator=(const CLoopPacer&) = delete;
+
+    void SetPeriod(std::chrono::nanoseconds period);
+    std::chrono::nanoseconds GetPeriod(void) const;
+    void SetSpinWindow(std::chrono::nanoseconds spinWindow);
+
+    // Bir sonraki deadline'i simdiden bir periyot sonraya kurar.
+    void Reset(void);
+
+    // Bir sonraki mutlak deadline'a kadar bekler. Deadline zaten gecmisse
+    // kacirilan olarak sayar, fazini koruyarak sonraki deadline'a atlar ve false doner.
+    bool Wait(void);
+
+    PacerStats GetStats(void) const;
+
+    static int64_t NowNs(void);
+
+private:
+    void SleepUntil(int64_t deadlineNs);
+    void RecordPeriod(int64_t nowNs);
+
+    std::atomic<int64_t> m_periodNs;
+    std::atomic<int64_t> m_spinNs;
+    int64_t m_nextDeadlineNs;
+    int64_t m_lastWakeNs;
+
+    std::atomic<uint64_t> m_iterations;
+    std::atomic<uint64_t> m_missed;
+    std::atomic<int64_t> m_periods[HistorySize];
+
+#ifdef _WIN32
+    void* m_timer;
+#endif
+};
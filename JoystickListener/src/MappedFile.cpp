@@ -0,0 +1,160 @@
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+CMappedFile::CMappedFile()
+#ifdef _WIN32
+    : m_file(INVALID_HANDLE_VALUE),
+    m_mapping(nullptr),
+#else
+    : m_file(-1),
+#endif
+    m_data(nullptr),
+    m_size(0)
+{
+}
+
+CMappedFile::~CMappedFile()
+{
+    Close();
+}
+
+CMappedFile::CMappedFile(CMappedFile&& other) noexcept
+    : CMappedFile()
+{
+    MoveFrom(other);
+}
+
+CMappedFile& CMappedFile::operator=(CMappedFile&& other) noexcept
+{
+    if (this != &other)
+    {
+        Close();
+        MoveFrom(other);
+    }
+    return *this;
+}
+
+void CMappedFile::MoveFrom(CMappedFile& other)
+{
+    m_file = other.m_file;
+#ifdef _WIN32
+    m_mapping = other.m_mapping;
+    other.m_file = INVALID_HANDLE_VALUE;
+    other.m_mapping = nullptr;
+#else
+    other.m_file = -1;
+#endif
+    m_data = other.m_data;
+    m_size = other.m_size;
+    other.m_data = nullptr;
+    other.m_size = 0;
+}
+
+bool CMappedFile::Open(const std::string& path)
+{
+    Close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL,
+        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+    {
+        // Bos dosya eslenemez
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : NULL;
+    if (!view)
+    {
+        if (mapping)
+            CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    m_file = file;
+    m_mapping = mapping;
+    m_data = static_cast<const uint8_t*>(view);
+    m_size = static_cast<size_t>(size.QuadPart);
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat info;
+    if (::fstat(fd, &info) != 0 || info.st_size == 0)
+    {
+        ::close(fd);
+        return false;
+    }
+
+    const size_t size = static_cast<size_t>(info.st_size);
+    void* view = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (view == MAP_FAILED)
+    {
+        ::close(fd);
+        return false;
+    }
+    ::madvise(view, size, MADV_SEQUENTIAL);
+
+    m_file = fd;
+    m_data = static_cast<const uint8_t*>(view);
+    m_size = size;
+#endif
+    return true;
+}
+
+void CMappedFile::Prefetch(size_t offset, size_t length) const
+{
+    if (!m_data || offset >= m_size)
+        return;
+    length = (length < m_size - offset) ? length : m_size - offset;
+
+#ifdef _WIN32
+#if defined(_WIN32_WINNT) && _WIN32_WINNT >= 0x0602
+    WIN32_MEMORY_RANGE_ENTRY range;
+    range.VirtualAddress = const_cast<uint8_t*>(m_data + offset);
+    range.NumberOfBytes = length;
+    PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+#endif
+#else
+    // madvise sayfa hizali baslangic ister
+    const size_t page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    const size_t aligned = offset & ~(page - 1);
+    ::madvise(const_cast<uint8_t*>(m_data + aligned), length + (offset - aligned), MADV_WILLNEED);
+#endif
+}
+
+void CMappedFile::Close(void)
+{
+    if (!m_data)
+        return;
+
+#ifdef _WIN32
+    UnmapViewOfFile(m_data);
+    CloseHandle(static_cast<HANDLE>(m_mapping));
+    CloseHandle(static_cast<HANDLE>(m_file));
+    m_mapping = nullptr;
+    m_file = INVALID_HANDLE_VALUE;
+#else
+    ::munmap(const_cast<uint8_t*>(m_data), m_size);
+    ::close(m_file);
+    m_file = -1;
+#endif
+    m_data = nullptr;
+    m_size = 0;
+}
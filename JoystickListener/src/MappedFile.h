@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Salt okunur dosya eslemesi. Sayfalar ilk eriside diskten gelir; sirali erisim ipucu
+// verilir (Win32 FILE_FLAG_SEQUENTIAL_SCAN, POSIX MADV_SEQUENTIAL).
+class CMappedFile
+{
+public:
+    CMappedFile();
+    ~CMappedFile();
+
+    CMappedFile(const CMappedFile&) = delete;
+    CMappedFile& operator=(const CMappedFile&) = delete;
+    CMappedFile(CMappedFile&& other) noexcept;
+    CMappedFile& operator=(CMappedFile&& other) noexcept;
+
+    bool Open(const std::string& path);
+    void Close(void);
+
+    bool IsOpen(void) const                 { return m_data != nullptr; }
+    const uint8_t* Data(void) const         { return m_data; }
+    size_t Size(void) const                 { return m_size; }
+
+    // Aralik icin on okuma baslatir (asenkron); desteklenmiyorsa bir sey yapmaz
+    void Prefetch(size_t offset, size_t length) const;
+
+private:
+    void MoveFrom(CMappedFile& other);
+
+#ifdef _WIN32
+    void* m_file;
+    void* m_mapping;
+#else
+    int m_file;
+#endif
+    const uint8_t* m_data;
+    size_t m_size;
+};
@@ -0,0 +1,357 @@
+#include "MappedFileLogger.h"
+#include "LoopPacer.h"
+
+#include <atomic>
+#include <cstring>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <algorithm>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
+// Segment: [SegmentHeader][Record]...[0...]
+// Record : uint32 length|CommitBit, uint32 checksum, int64 timestampNs, payload, 8'e hizali dolgu
+static const char     SegmentMagic[4] = { 'J', 'L', 'L', 'G' };
+static const uint32_t SegmentVersion = 1;
+static const uint32_t CommitBit = 0x80000000u;
+static const size_t   RecordHeaderSize = 16;
+
+struct SegmentHeader {
+    char     magic[4];
+    uint32_t version;
+    uint64_t segmentIndex;
+    uint64_t segmentBytes;
+    int64_t  createdNs;
+};
+
+static_assert(sizeof(SegmentHeader) == 32, "SegmentHeader layout");
+
+static size_t AlignRecord(size_t bytes) {
+    return (bytes + 7) & ~static_cast<size_t>(7);
+}
+
+static uint32_t RecordChecksum(int64_t timestampNs, const uint8_t* payload, size_t length) {
+    // FNV-1a; yarim yazilmis sayfalari yakalamak icin yeterli
+    uint32_t hash = 2166136261u;
+    const uint8_t* ts = reinterpret_cast<const uint8_t*>(&timestampNs);
+    for (size_t i = 0; i < sizeof(timestampNs); ++i) {
+        hash = (hash ^ ts[i]) * 16777619u;
+    }
+    for (size_t i = 0; i < length; ++i) {
+        hash = (hash ^ payload[i]) * 16777619u;
+    }
+    return hash;
+}
+
+MappedFileLogger::MappedFileLogger(const MappedLogConfig& config)
+    : config_(config),
+#ifdef _WIN32
+    file_(INVALID_HANDLE_VALUE),
+    mapping_(nullptr),
+#else
+    file_(-1),
+#endif
+    view_(nullptr),
+    capacity_(0),
+    offset_(0),
+    segmentIndex_(0),
+    dropped_(0)
+{
+    if (config_.segmentBytes < sizeof(SegmentHeader) + RecordHeaderSize + 64) {
+        config_.segmentBytes = sizeof(SegmentHeader) + RecordHeaderSize + 64;
+    }
+
+    // Var olan segmentlere dokunulmaz; kaldigi yerden yeni segmentle devam edilir
+    std::vector<uint64_t> existing = ListSegments(config_.basePath);
+    OpenSegment(existing.empty() ? 1 : existing.back() + 1);
+    RemoveOldSegments();
+}
+
+MappedFileLogger::~MappedFileLogger() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    CloseSegment();
+}
+
+std::string MappedFileLogger::SegmentPath(const std::string& basePath, uint64_t index) {
+    char suffix[32];
+    std::snprintf(suffix, sizeof(suffix), ".%06llu.jlog", static_cast<unsigned long long>(index));
+    return basePath + suffix;
+}
+
+std::vector<uint64_t> MappedFileLogger::ListSegments(const std::string& basePath) {
+    namespace fs = std::filesystem;
+
+    std::vector<uint64_t> indices;
+    fs::path base(basePath);
+    fs::path dir = base.has_parent_path() ? base.parent_path() : fs::path(".");
+    const std::string prefix = base.filename().string() + ".";
+    const std::string suffix = ".jlog";
+
+    std::error_code ec;
+    for (fs::directory_iterator it(dir, ec), end; !ec && it != end; it.increment(ec)) {
+        const std::string name = it->path().filename().string();
+        if (name.size() <= prefix.size() + suffix.size() ||
+            name.compare(0, prefix.size(), prefix) != 0 ||
+            name.compare(name.size() - suffix.size(), suffix.size(), suffix) != 0) {
+            continue;
+        }
+
+        const std::string digits = name.substr(prefix.size(), name.size() - prefix.size() - suffix.size());
+        if (digits.empty() || !std::all_of(digits.begin(), digits.end(), [](char c) { return c >= '0' && c <= '9'; })) {
+            continue;
+        }
+        indices.push_back(std::stoull(digits));
+    }
+
+    std::sort(indices.begin(), indices.end());
+    return indices;
+}
+
+bool MappedFileLogger::OpenSegment(uint64_t index) {
+    const std::string path = SegmentPath(config_.basePath, index);
+    const size_t bytes = config_.segmentBytes;
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_DELETE,
+        NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    // Dosya bastan tam boyuna genisletilir; yazilmamis bolge sifir okunur
+    LARGE_INTEGER size;
+    size.QuadPart = static_cast<LONGLONG>(bytes);
+    HANDLE mapping = NULL;
+    void* view = NULL;
+    if (SetFilePointerEx(file, size, NULL, FILE_BEGIN) && SetEndOfFile(file)) {
+        mapping = CreateFileMappingA(file, NULL, PAGE_READWRITE, static_cast<DWORD>(size.HighPart), size.LowPart, NULL);
+    }
+    if (mapping) {
+        view = MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, bytes);
+    }
+    if (!view) {
+        if (mapping) {
+            CloseHandle(mapping);
+        }
+        CloseHandle(file);
+        return false;
+    }
+
+    file_ = file;
+    mapping_ = mapping;
+    view_ = static_cast<uint8_t*>(view);
+#else
+    int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        return false;
+    }
+
+    // fallocate ile bloklar simdi ayrilir; desteklenmiyorsa seyrek dosya
+    if (::posix_fallocate(fd, 0, static_cast<off_t>(bytes)) != 0 && ::ftruncate(fd, static_cast<off_t>(bytes)) != 0) {
+        ::close(fd);
+        return false;
+    }
+
+    void* view = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (view == MAP_FAILED) {
+        ::close(fd);
+        return false;
+    }
+
+    file_ = fd;
+    view_ = static_cast<uint8_t*>(view);
+#endif
+
+    capacity_ = bytes;
+    segmentIndex_ = index;
+
+    SegmentHeader header;
+    std::memcpy(header.magic, SegmentMagic, sizeof(header.magic));
+    header.version = SegmentVersion;
+    header.segmentIndex = index;
+    header.segmentBytes = bytes;
+    header.createdNs = CLoopPacer::NowNs();
+    std::memcpy(view_, &header, sizeof(header));
+    offset_ = sizeof(SegmentHeader);
+    return true;
+}
+
+void MappedFileLogger::CloseSegment() {
+    if (!view_) {
+        return;
+    }
+
+#ifdef _WIN32
+    FlushViewOfFile(view_, 0);
+    UnmapViewOfFile(view_);
+    CloseHandle(static_cast<HANDLE>(mapping_));
+    CloseHandle(static_cast<HANDLE>(file_));
+    mapping_ = nullptr;
+    file_ = INVALID_HANDLE_VALUE;
+#else
+    ::msync(view_, capacity_, MS_ASYNC);
+    ::munmap(view_, capacity_);
+    ::close(file_);
+    file_ = -1;
+#endif
+
+    view_ = nullptr;
+    capacity_ = 0;
+    offset_ = 0;
+}
+
+void MappedFileLogger::RemoveOldSegments() {
+    if (config_.retainSegments <= 0) {
+        return;
+    }
+
+    std::vector<uint64_t> indices = ListSegments(config_.basePath);
+    size_t excess = indices.size() > static_cast<size_t>(config_.retainSegments) ? indices.size() - config_.retainSegments : 0;
+    for (size_t i = 0; i < excess; ++i) {
+        if (indices[i] == segmentIndex_) {
+            continue;
+        }
+        std::error_code ec;
+        std::filesystem::remove(SegmentPath(config_.basePath, indices[i]), ec);
+    }
+}
+
+void MappedFileLogger::Append(int64_t timestampNs, std::string_view message) {
+    const size_t maxPayload = config_.segmentBytes - sizeof(SegmentHeader) - RecordHeaderSize;
+    if (message.size() > maxPayload) {
+        message = message.substr(0, maxPayload);
+    }
+
+    const size_t recordBytes = AlignRecord(RecordHeaderSize + message.size());
+    if (!view_ || offset_ + recordBytes > capacity_) {
+        const uint64_t next = segmentIndex_ + 1;
+        CloseSegment();
+        if (!OpenSegment(next)) {
+            ++dropped_;
+            return;
+        }
+        RemoveOldSegments();
+    }
+
+    uint8_t* record = view_ + offset_;
+    const uint32_t checksum = RecordChecksum(timestampNs, reinterpret_cast<const uint8_t*>(message.data()), message.size());
+    std::memcpy(record + 4, &checksum, sizeof(checksum));
+    std::memcpy(record + 8, &timestampNs, sizeof(timestampNs));
+    std::memcpy(record + RecordHeaderSize, message.data(), message.size());
+
+    // Uzunluk kaydi onaylar; govdeden once gorunmemeli
+    std::atomic_ref<uint32_t> length(*reinterpret_cast<uint32_t*>(record));
+    length.store(static_cast<uint32_t>(message.size()) | CommitBit, std::memory_order_release);
+
+    offset_ += recordBytes;
+}
+
+void MappedFileLogger::Log(std::string_view message) {
+    const int64_t now = CLoopPacer::NowNs();
+    std::lock_guard<std::mutex> lock(mutex_);
+    Append(now, message);
+}
+
+void MappedFileLogger::LogBatch(std::span<const std::string_view> messages) {
+    const int64_t now = CLoopPacer::NowNs();
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (std::string_view message : messages) {
+        Append(now, message);
+    }
+}
+
+void MappedFileLogger::Flush() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!view_) {
+        return;
+    }
+#ifdef _WIN32
+    FlushViewOfFile(view_, offset_);
+#else
+    ::msync(view_, capacity_, MS_ASYNC);
+#endif
+}
+
+bool MappedFileLogger::IsOpen() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return view_ != nullptr;
+}
+
+uint64_t MappedFileLogger::GetSegmentIndex() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return segmentIndex_;
+}
+
+uint64_t MappedFileLogger::GetDroppedCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return dropped_;
+}
+
+MappedLogRecovery MappedLogReader::ReadSegment(const std::string& path, std::vector<MappedLogRecord>& records) {
+    MappedLogRecovery recovery;
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return recovery;
+    }
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    SegmentHeader header;
+    if (data.size() < sizeof(header)) {
+        return recovery;
+    }
+    std::memcpy(&header, data.data(), sizeof(header));
+    if (std::memcmp(header.magic, SegmentMagic, sizeof(header.magic)) != 0 || header.version != SegmentVersion) {
+        return recovery;
+    }
+    recovery.segments = 1;
+
+    size_t offset = sizeof(SegmentHeader);
+    while (offset + RecordHeaderSize <= data.size()) {
+        uint32_t length = 0;
+        uint32_t checksum = 0;
+        int64_t timestampNs = 0;
+        std::memcpy(&length, data.data() + offset, sizeof(length));
+        if (length == 0) {
+            break;      // yazilmamis bolge
+        }
+
+        std::memcpy(&checksum, data.data() + offset + 4, sizeof(checksum));
+        std::memcpy(&timestampNs, data.data() + offset + 8, sizeof(timestampNs));
+        const size_t payload = length & ~CommitBit;
+        if ((length & CommitBit) == 0 || offset + RecordHeaderSize + payload > data.size() ||
+            RecordChecksum(timestampNs, data.data() + offset + RecordHeaderSize, payload) != checksum) {
+            ++recovery.tornRecords;
+            break;
+        }
+
+        MappedLogRecord record;
+        record.timestampNs = timestampNs;
+        record.segmentIndex = header.segmentIndex;
+        record.message.assign(reinterpret_cast<const char*>(data.data() + offset + RecordHeaderSize), payload);
+        records.push_back(std::move(record));
+        ++recovery.records;
+
+        offset += AlignRecord(RecordHeaderSize + payload);
+    }
+
+    return recovery;
+}
+
+MappedLogRecovery MappedLogReader::ReadAll(const std::string& basePath, std::vector<MappedLogRecord>& records) {
+    MappedLogRecovery total;
+    for (uint64_t index : MappedFileLogger::ListSegments(basePath)) {
+        MappedLogRecovery r = ReadSegment(MappedFileLogger::SegmentPath(basePath, index), records);
+        total.segments += r.segments;
+        total.records += r.records;
+        total.tornRecords += r.tornRecords;
+    }
+    return total;
+}
@@ -0,0 +1,85 @@
+#pragma once
+#include "ILogger.h"
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+struct MappedLogConfig {
+    std::string basePath = "jl";            // segmentler <basePath>.000001.jlog, ...
+    size_t      segmentBytes = 4 << 20;     // onceden ayrilan segment boyu
+    int         retainSegments = 8;         // 0: hic silinmez
+};
+
+// Sabit boyutlu, onceden ayrilmis segment dosyalarina mmap uzerinden memcpy ile yazan sink.
+// Segment dolunca yenisine gecilir, en eski segmentler retainSegments'e gore silinir.
+// Kayit basligindaki uzunluk en son yazilir ve govde checksum'la korunur; surec
+// oldurulse de okuyucu tum tamamlanmis kayitlari geri alir.
+// Maliyet: normal kayit kilit altinda memcpy'dir, dosya G/C'si yoktur. Segment dolunca
+// rotasyon (eski segmentin msync/munmap'i, yenisinin olusturulup fallocate ve mmap'i,
+// eski segmentlerin silinmesi) kilit altinda ve o anda Log cagiran thread'de yapilir;
+// segmentBytes basina bir kez, disk hizina bagli olarak yavas olabilir.
+class MappedFileLogger : public ILogger {
+public:
+    explicit MappedFileLogger(const MappedLogConfig& config = MappedLogConfig());
+    ~MappedFileLogger() override;
+
+    MappedFileLogger(const MappedFileLogger&) = delete;
+    MappedFileLogger& operator=(const MappedFileLogger&) = delete;
+
+    void Log(std::string_view message) override;
+    void LogBatch(std::span<const std::string_view> messages) override;
+
+    // Kirli sayfalari diske yazmaya baslatir (asenkron).
+    void Flush();
+
+    // Herhangi bir thread'den; yazarlarla ayni kilidi alir.
+    bool IsOpen() const;
+    uint64_t GetSegmentIndex() const;
+    uint64_t GetDroppedCount() const;
+
+    static std::string SegmentPath(const std::string& basePath, uint64_t index);
+
+    // basePath'e ait mevcut segment indeksleri, artan sirada
+    static std::vector<uint64_t> ListSegments(const std::string& basePath);
+
+private:
+    bool OpenSegment(uint64_t index);
+    void CloseSegment();
+    void Append(int64_t timestampNs, std::string_view message);
+    void RemoveOldSegments();
+
+    MappedLogConfig config_;
+    mutable std::mutex mutex_;
+
+#ifdef _WIN32
+    void* file_;
+    void* mapping_;
+#else
+    int file_;
+#endif
+    uint8_t* view_;
+    size_t capacity_;
+    size_t offset_;
+    uint64_t segmentIndex_;
+    uint64_t dropped_;
+};
+
+struct MappedLogRecord {
+    int64_t     timestampNs;
+    uint64_t    segmentIndex;
+    std::string message;
+};
+
+struct MappedLogRecovery {
+    size_t segments = 0;
+    size_t records = 0;
+    size_t tornRecords = 0;     // checksum'i tutmayan veya yarim kalan son kayit
+};
+
+// Segmentleri okuyup gecerli kayitlari dondurur; yazici hala calisirken de kullanilabilir.
+class MappedLogReader {
+public:
+    static MappedLogRecovery ReadSegment(const std::string& path, std::vector<MappedLogRecord>& records);
+    static MappedLogRecovery ReadAll(const std::string& basePath, std::vector<MappedLogRecord>& records);
+};
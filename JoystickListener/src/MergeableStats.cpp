@@ -0,0 +1,143 @@
+#include "MergeableStats.h"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+void RunningStats::Merge(const RunningStats& other)
+{
+    count += other.count;
+    sum += other.sum;
+    min = std::min(min, other.min);
+    max = std::max(max, other.max);
+}
+
+CLinearHistogram::CLinearHistogram(double lo, double hi, int binCount)
+    : m_lo(lo),
+    m_hi(hi),
+    m_scale(binCount / (hi - lo)),
+    m_bins(static_cast<size_t>(binCount), 0),
+    m_underflow(0),
+    m_overflow(0),
+    m_count(0)
+{
+}
+
+void CLinearHistogram::Merge(const CLinearHistogram& other)
+{
+    if (other.m_bins.size() != m_bins.size() || other.m_lo != m_lo || other.m_hi != m_hi)
+        return;
+
+    for (size_t i = 0; i < m_bins.size(); ++i)
+        m_bins[i] += other.m_bins[i];
+    m_underflow += other.m_underflow;
+    m_overflow += other.m_overflow;
+    m_count += other.m_count;
+}
+
+double CLinearHistogram::Quantile(double q) const
+{
+    if (m_count == 0)
+        return 0.0;
+
+    const double rank = std::clamp(q, 0.0, 1.0) * m_count;
+    double seen = static_cast<double>(m_underflow);
+    if (rank <= seen)
+        return m_lo;
+
+    const double width = (m_hi - m_lo) / m_bins.size();
+    for (size_t i = 0; i < m_bins.size(); ++i)
+    {
+        if (m_bins[i] && rank <= seen + m_bins[i])
+            return m_lo + width * (i + (rank - seen) / m_bins[i]);
+        seen += m_bins[i];
+    }
+    return m_hi;
+}
+
+std::string CLinearHistogram::Sparkline(int width) const
+{
+    static const char Levels[] = " .:-=+*#%@";
+    const int levelCount = static_cast<int>(sizeof(Levels)) - 2;
+
+    std::vector<uint64_t> cells(static_cast<size_t>(std::max(width, 1)), 0);
+    for (size_t i = 0; i < m_bins.size(); ++i)
+        cells[i * cells.size() / m_bins.size()] += m_bins[i];
+
+    const uint64_t peak = *std::max_element(cells.begin(), cells.end());
+    std::string line;
+    line.reserve(cells.size());
+    for (uint64_t c : cells)
+    {
+        // Logaritmik; seyrek kutular da gorunur kalir
+        const int level = (peak && c) ? 1 + static_cast<int>((levelCount - 1) * std::log1p(static_cast<double>(c)) / std::log1p(static_cast<double>(peak))) : 0;
+        line += Levels[level];
+    }
+    return line;
+}
+
+CQuantileSketch::CQuantileSketch(double relativeAccuracy)
+    : m_relativeAccuracy(relativeAccuracy),
+    m_gamma((1.0 + relativeAccuracy) / (1.0 - relativeAccuracy)),
+    m_invLogGamma(1.0 / std::log(m_gamma)),
+    m_buckets(BucketCount, 0),
+    m_zeroCount(0),
+    m_count(0),
+    m_sum(0.0),
+    m_min(std::numeric_limits<double>::infinity()),
+    m_max(-std::numeric_limits<double>::infinity())
+{
+}
+
+void CQuantileSketch::Add(double value)
+{
+    if (value < 1.0)
+        ++m_zeroCount;
+    else
+    {
+        const int index = static_cast<int>(std::ceil(std::log(value) * m_invLogGamma));
+        ++m_buckets[static_cast<size_t>(std::min(index, BucketCount - 1))];
+    }
+
+    ++m_count;
+    m_sum += value;
+    m_min = std::min(m_min, value);
+    m_max = std::max(m_max, value);
+}
+
+void CQuantileSketch::Merge(const CQuantileSketch& other)
+{
+    if (other.m_relativeAccuracy != m_relativeAccuracy)
+        return;
+
+    for (size_t i = 0; i < m_buckets.size(); ++i)
+        m_buckets[i] += other.m_buckets[i];
+    m_zeroCount += other.m_zeroCount;
+    m_count += other.m_count;
+    m_sum += other.m_sum;
+    m_min = std::min(m_min, other.m_min);
+    m_max = std::max(m_max, other.m_max);
+}
+
+double CQuantileSketch::Quantile(double q) const
+{
+    if (m_count == 0)
+        return 0.0;
+
+    const uint64_t rank = static_cast<uint64_t>(std::clamp(q, 0.0, 1.0) * (m_count - 1));
+    uint64_t seen = m_zeroCount;
+    if (rank < seen)
+        return m_min;
+
+    for (size_t i = 0; i < m_buckets.size(); ++i)
+    {
+        seen += m_buckets[i];
+        if (rank < seen)
+        {
+            // Kutu ortasi (goreli hata her iki yone esit); gozlenen aralikla sinirli
+            const double value = 2.0 * std::pow(m_gamma, static_cast<double>(i)) / (m_gamma + 1.0);
+            return std::clamp(value, m_min, m_max);
+        }
+    }
+    return m_max;
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+// Bolum basina ayri tutulup sonradan birlestirilen istatistikler. Merge sirasi sonucu
+// degistirmez; thread'ler paylasimsiz biriktirir, birlestirme tek thread'de yapilir.
+
+struct RunningStats
+{
+    uint64_t count = 0;
+    double   sum = 0.0;
+    double   min = std::numeric_limits<double>::infinity();
+    double   max = -std::numeric_limits<double>::infinity();
+
+    void Add(double value)
+    {
+        ++count;
+        sum += value;
+        if (value < min) min = value;
+        if (value > max) max = value;
+    }
+
+    void Merge(const RunningStats& other);
+    double Mean(void) const                 { return count ? sum / count : 0.0; }
+};
+
+// [lo, hi) araliginda esit genislikte kutular; aralik disi ayri sayilir.
+class CLinearHistogram
+{
+public:
+    CLinearHistogram(double lo = 0.0, double hi = 1.0, int binCount = 64);
+
+    void Add(double value)
+    {
+        const double x = (value - m_lo) * m_scale;
+        if (x < 0.0)
+            ++m_underflow;
+        else if (x >= m_bins.size())
+            ++m_overflow;
+        else
+            ++m_bins[static_cast<size_t>(x)];
+        ++m_count;
+    }
+
+    // Ayni aralik ve kutu sayisi olmali
+    void Merge(const CLinearHistogram& other);
+
+    uint64_t Count(void) const                          { return m_count; }
+    const std::vector<uint64_t>& Bins(void) const       { return m_bins;  }
+    double Lo(void) const                               { return m_lo;    }
+    double Hi(void) const                               { return m_hi;    }
+
+    // Kutu icinde dogrusal; aralik disi kutular uclara yapisir
+    double Quantile(double q) const;
+
+    // Kutulari width karakterlik yogunluk seridine indirger (" .:-=+*#%@")
+    std::string Sparkline(int width = 32) const;
+
+private:
+    double m_lo;
+    double m_hi;
+    double m_scale;
+    std::vector<uint64_t> m_bins;
+    uint64_t m_underflow;
+    uint64_t m_overflow;
+    uint64_t m_count;
+};
+
+// Goreli hataya bagli logaritmik kutulu nicelik ozeti (DDSketch benzeri). Kutu i,
+// (gamma^(i-1), gamma^i] araligini tutar; donen nicelik gercek degere relativeAccuracy
+// icinde. Birlestirme kutu sayilarinin toplami, bu yuzden bolumleme sonucu degistirmez.
+// Pozitif degerler (sure, gecikme); 1'in altindakiler sifir kutusuna gider.
+class CQuantileSketch
+{
+public:
+    explicit CQuantileSketch(double relativeAccuracy = 0.01);
+
+    void Add(double value);
+    // Ayni relativeAccuracy olmali
+    void Merge(const CQuantileSketch& other);
+
+    uint64_t Count(void) const          { return m_count; }
+    double Min(void) const              { return m_count ? m_min : 0.0; }
+    double Max(void) const              { return m_count ? m_max : 0.0; }
+    double Mean(void) const             { return m_count ? m_sum / m_count : 0.0; }
+    double Quantile(double q) const;
+
+private:
+    static const int BucketCount = 2048;    // %1 hatada ~1 .. 5e17
+
+    double m_relativeAccuracy;
+    double m_gamma;
+    double m_invLogGamma;
+    std::vector<uint64_t> m_buckets;
+    uint64_t m_zeroCount;
+    uint64_t m_count;
+    double m_sum;
+    double m_min;
+    double m_max;
+};
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// Sinirli, cok ureticili / tek tuketicili kilitsiz kuyruk (Vyukov hucre sirasi).
+// Her hucrenin sira numarasi hucrenin bos/dolu oldugunu ve hangi tura ait oldugunu
+// gosterir; ureticiler tail'i CAS ile ayirir, tuketici kilitsiz okur.
+// TryPushBatch tek CAS ile ardisik hucreler ayirir; poll basina bir batch gonderen
+// listener'larda paylasilan tail uzerindeki cekisme batch sayisiyla sinirli kalir.
+// Not: hucre ayirip yazmayi bitirmemis bir uretici, tuketiciyi o hucrede bekletir.
+template<typename T>
+class CMpscQueue
+{
+public:
+    explicit CMpscQueue(size_t capacity)
+        : m_tail(0), m_head(0)
+    {
+        size_t size = 1;
+        while (size < capacity)
+            size <<= 1;
+        m_mask = size - 1;
+        m_cells = std::vector<Cell>(size);
+        for (size_t i = 0; i < size; ++i)
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    // Uretici tarafi (herhangi bir thread)
+    bool TryPush(const T& item)
+    {
+        return TryPushBatch(std::span<const T>(&item, 1));
+    }
+
+    // Ya hepsi ya hicbiri; dolu kuyrukta false
+    bool TryPushBatch(std::span<const T> items)
+    {
+        const size_t count = items.size();
+        if (count == 0)
+            return true;
+        if (count > m_mask + 1)
+            return false;
+
+        size_t pos = m_tail.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            // Tek tuketici hucreleri sirayla bosalttigi icin son hucre bossa oncekiler de bostur
+            const Cell& last = m_cells[(pos + count - 1) & m_mask];
+            const size_t seq = last.sequence.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + count - 1);
+
+            if (diff == 0)
+            {
+                if (m_tail.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed))
+                    break;
+            }
+            else if (diff < 0)
+            {
+                return false;
+            }
+            else
+            {
+                pos = m_tail.load(std::memory_order_relaxed);
+            }
+        }
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            Cell& cell = m_cells[(pos + i) & m_mask];
+            cell.value = items[i];
+            cell.sequence.store(pos + i + 1, std::memory_order_release);
+        }
+        return true;
+    }
+
+    // Tuketici tarafi (tek thread)
+    bool TryPop(T& item)
+    {
+        const size_t head = m_head.load(std::memory_order_relaxed);
+        Cell& cell = m_cells[head & m_mask];
+        if (cell.sequence.load(std::memory_order_acquire) != head + 1)
+            return false;
+
+        item = cell.value;
+        cell.sequence.store(head + m_mask + 1, std::memory_order_release);
+        m_head.store(head + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Anlik (yaklasik) doluluk; ayrilmis ama henuz yazilmamis hucreleri de sayar.
+    // Once head okunur: tail yalnizca artar, fark tuketici disindaki thread'lerde de eksiye dusmez.
+    size_t Size(void) const
+    {
+        const size_t head = m_head.load(std::memory_order_acquire);
+        const size_t tail = m_tail.load(std::memory_order_acquire);
+        return std::min(tail - head, Capacity());
+    }
+
+    size_t Capacity(void) const
+    {
+        return m_mask + 1;
+    }
+
+private:
+    struct Cell
+    {
+        std::atomic<size_t> sequence{ 0 };
+        T value{};
+    };
+
+    std::vector<Cell> m_cells;
+    size_t m_mask;
+
+    alignas(64) std::atomic<size_t> m_tail;
+    alignas(64) std::atomic<size_t> m_head;
+};
@@ -0,0 +1,427 @@
+#include "ReplayHarness.h"
+
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <cmath>
+#include <cstdlib>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <filesystem>
+
+#include "Aircraft.h"
+#include "AircraftCommand.h"
+#include "JoystickListener.h"
+#include "JoystickListenerDI.h"
+
+static const char* TrajectoryColumnNames[TrajectoryRow::ColumnCount] =
+{
+    "iterCount",
+    "rollCmd", "pitchCmd", "yawCmd", "throttleCmd",
+    "roll", "pitch", "yaw", "throttle",
+    "heading", "latitude", "longitude", "altitude", "speed"
+};
+
+const char* TrajectoryRow::ColumnName(int column)
+{
+    return (column >= 0 && column < ColumnCount) ? TrajectoryColumnNames[column] : "?";
+}
+
+static TrajectoryRow CaptureRow(CAircraft& aircraft, int64_t timeNs)
+{
+    TrajectoryRow row;
+    row.timeNs = timeNs;
+    row.values[TrajectoryRow::ColIterCount]   = aircraft.GetIterCount();
+    row.values[TrajectoryRow::ColRollCmd]     = aircraft.GetRollCmd();
+    row.values[TrajectoryRow::ColPitchCmd]    = aircraft.GetPitchCmd();
+    row.values[TrajectoryRow::ColYawCmd]      = aircraft.GetYawCmd();
+    row.values[TrajectoryRow::ColThrottleCmd] = aircraft.GetThrottleCmd();
+    row.values[TrajectoryRow::ColRoll]        = aircraft.GetRoll();
+    row.values[TrajectoryRow::ColPitch]       = aircraft.GetPitch();
+    row.values[TrajectoryRow::ColYaw]         = aircraft.GetYaw();
+    row.values[TrajectoryRow::ColThrottle]    = aircraft.GetThrottle();
+    row.values[TrajectoryRow::ColHeading]     = aircraft.GetHeading();
+    row.values[TrajectoryRow::ColLatitude]    = aircraft.GetLatitude();
+    row.values[TrajectoryRow::ColLongitude]   = aircraft.GetLongitude();
+    row.values[TrajectoryRow::ColAltitude]    = aircraft.GetAltitude();
+    row.values[TrajectoryRow::ColSpeed]       = aircraft.GetSpeed();
+    return row;
+}
+
+// Ornekleri sanal saate gore listener'a verir, her tick'te CAircraft::Update() cagirir.
+template<typename Listener, typename DeviceState>
+static std::vector<TrajectoryRow> ReplayWith(Listener& listener, const std::vector<InputSample>& samples, int64_t tickPeriodNs)
+{
+    std::vector<TrajectoryRow> rows;
+    if (samples.empty() || tickPeriodNs <= 0)
+        return rows;
+
+    const int64_t t0 = samples.front().timestampNs;
+    const int64_t tEnd = samples.back().timestampNs;
+    rows.reserve(static_cast<size_t>((tEnd - t0) / tickPeriodNs + 1));
+
+    // Listener handler'i PostCommand ile posta kutusuna yazar, Update() uygular.
+    CAircraft aircraft;
+    listener.SetExternalObject(&aircraft);
+
+    DeviceState state;
+    size_t next = 0;
+
+    for (int64_t t = t0; t <= tEnd; t += tickPeriodNs)
+    {
+        while (next < samples.size() && samples[next].timestampNs <= t)
+        {
+            Listener::FromSample(samples[next], state);
+            listener.ProcessState(state, samples[next].timestampNs);
+            ++next;
+        }
+
+        aircraft.Update();
+        rows.push_back(CaptureRow(aircraft, t - t0));
+    }
+
+    return rows;
+}
+
+CReplayHarness::CReplayHarness(const ReplayOptions& options)
+    : m_options(options)
+{
+}
+
+std::vector<TrajectoryRow> CReplayHarness::Replay(const CInputSession& session, int64_t tickPeriodNs)
+{
+    const std::vector<InputSample>& samples = session.GetSamples();
+
+    if (session.GetDeviceKind() == InputDeviceKind::DirectInput)
+    {
+        CJoystickListenerDI listener(GUID{});
+        listener.SetNormalize(true);
+        listener.ResetState();
+        listener.SetAxisHandler([&listener](double x, double y, double z, double rz, double pov, std::string_view povDir) {
+            CAircraft* pAircraft = (CAircraft*)listener.GetExternalObject();
+            if (pAircraft)
+                pAircraft->PostCommand(AircraftCommand::FromAxes(x, y, z, rz));
+            });
+        return ReplayWith<CJoystickListenerDI, DIJOYSTATE2>(listener, samples, tickPeriodNs);
+    }
+
+    CJoystickListener listener(0);
+    listener.SetNormalize(true);
+    listener.ResetState();
+    listener.SetAxisHandler([&listener](double x, double y, double z, double pov, std::string_view povDir) {
+        CAircraft* pAircraft = (CAircraft*)listener.GetExternalObject();
+        if (pAircraft)
+            pAircraft->PostCommand(AircraftCommand::FromAxes(x, y, z, 0));
+        });
+    return ReplayWith<CJoystickListener, JOYINFOEX>(listener, samples, tickPeriodNs);
+}
+
+bool CReplayHarness::WriteTrajectory(const std::string& filename, const std::vector<TrajectoryRow>& rows)
+{
+    std::ofstream file(filename, std::ios::trunc);
+    if (!file.is_open())
+        return false;
+
+    file << "timeNs";
+    for (int c = 0; c < TrajectoryRow::ColumnCount; ++c)
+        file << "," << TrajectoryRow::ColumnName(c);
+    file << "\n";
+
+    file << std::setprecision(17);
+    for (const TrajectoryRow& row : rows)
+    {
+        file << row.timeNs;
+        for (int c = 0; c < TrajectoryRow::ColumnCount; ++c)
+            file << "," << row.values[c];
+        file << "\n";
+    }
+    return static_cast<bool>(file);
+}
+
+bool CReplayHarness::ReadTrajectory(const std::string& filename, std::vector<TrajectoryRow>& rows)
+{
+    std::ifstream file(filename);
+    if (!file.is_open())
+        return false;
+
+    rows.clear();
+    std::string line;
+    if (!std::getline(file, line))
+        return false;
+
+    while (std::getline(file, line))
+    {
+        if (line.empty())
+            continue;
+
+        TrajectoryRow row;
+        const char* p = line.c_str();
+        char* end = nullptr;
+        row.timeNs = std::strtoll(p, &end, 10);
+        for (int c = 0; c < TrajectoryRow::ColumnCount; ++c)
+        {
+            if (*end != ',')
+                return false;
+            p = end + 1;
+            row.values[c] = std::strtod(p, &end);
+            if (end == p)
+                return false;
+        }
+        rows.push_back(row);
+    }
+    return true;
+}
+
+std::string CReplayHarness::GoldenPathFor(const std::string& sessionPath)
+{
+    std::filesystem::path path(sessionPath);
+    path.replace_extension(".golden.csv");
+    return path.string();
+}
+
+bool CReplayHarness::Compare(const std::vector<TrajectoryRow>& actual, const std::vector<TrajectoryRow>& expected, std::string& message) const
+{
+    const size_t count = std::min(actual.size(), expected.size());
+    for (size_t i = 0; i < count; ++i)
+    {
+        const TrajectoryRow& a = actual[i];
+        const TrajectoryRow& e = expected[i];
+
+        if (a.timeNs != e.timeNs)
+        {
+            std::stringstream ss;
+            ss << "row " << i << ": timeNs expected " << e.timeNs << ", actual " << a.timeNs;
+            message = ss.str();
+            return false;
+        }
+
+        for (int c = 0; c < TrajectoryRow::ColumnCount; ++c)
+        {
+            const double diff = std::fabs(a.values[c] - e.values[c]);
+            if (diff > m_options.absTolerance + m_options.relTolerance * std::fabs(e.values[c]))
+            {
+                std::stringstream ss;
+                ss << std::setprecision(17);
+                ss << "row " << i << " (t=" << e.timeNs << " ns) " << TrajectoryRow::ColumnName(c)
+                   << ": expected " << e.values[c] << ", actual " << a.values[c] << ", diff " << diff;
+                message = ss.str();
+                return false;
+            }
+        }
+    }
+
+    if (actual.size() != expected.size())
+    {
+        std::stringstream ss;
+        ss << "row count: expected " << expected.size() << ", actual " << actual.size();
+        message = ss.str();
+        return false;
+    }
+
+    return true;
+}
+
+ReplayResult CReplayHarness::RunCase(const std::string& sessionPath) const
+{
+    ReplayResult result;
+    result.sessionPath = sessionPath;
+    result.goldenPath = GoldenPathFor(sessionPath);
+
+    CInputSession session;
+    if (!session.Load(sessionPath))
+    {
+        result.message = "cannot load session";
+        return result;
+    }
+
+    std::vector<TrajectoryRow> actual = Replay(session, m_options.tickPeriodNs);
+    result.rowCount = actual.size();
+
+    if (m_options.updateGolden)
+    {
+        result.blessed = WriteTrajectory(result.goldenPath, actual);
+        result.passed = result.blessed;
+        result.message = result.blessed ? "golden updated" : "cannot write golden";
+        return result;
+    }
+
+    std::vector<TrajectoryRow> expected;
+    if (!ReadTrajectory(result.goldenPath, expected))
+    {
+        result.message = "missing or invalid golden (run with update-golden)";
+        return result;
+    }
+
+    result.passed = Compare(actual, expected, result.message);
+    return result;
+}
+
+std::vector<ReplayResult> CReplayHarness::RunCorpus(const std::string& directory) const
+{
+    std::vector<std::string> sessions;
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(directory, ec))
+    {
+        if (entry.is_regular_file() && entry.path().extension() == ".jlss")
+            sessions.push_back(entry.path().string());
+    }
+    std::sort(sessions.begin(), sessions.end());
+
+    std::vector<ReplayResult> results(sessions.size());
+
+    unsigned threadCount = m_options.threadCount > 0
+        ? static_cast<unsigned>(m_options.threadCount)
+        : std::max(1u, std::thread::hardware_concurrency());
+    threadCount = std::min<unsigned>(threadCount, static_cast<unsigned>(std::max<size_t>(sessions.size(), 1)));
+
+    // Her oturum bagimsiz (kendi listener ve CAircraft'i); isler atomik indeksle dagitilir.
+    std::atomic<size_t> nextIndex(0);
+    auto worker = [&]() {
+        for (;;)
+        {
+            size_t i = nextIndex.fetch_add(1, std::memory_order_relaxed);
+            if (i >= sessions.size())
+                break;
+            results[i] = RunCase(sessions[i]);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (unsigned t = 1; t < threadCount; ++t)
+        workers.emplace_back(worker);
+    worker();
+    for (auto& w : workers)
+        w.join();
+
+    return results;
+}
+
+void CReplayHarness::PrintSummary(std::ostream& os, const std::vector<ReplayResult>& results)
+{
+    size_t passed = 0;
+    for (const ReplayResult& r : results)
+    {
+        os << (r.blessed ? "[BLESS] " : (r.passed ? "[PASS]  " : "[FAIL]  ")) << r.sessionPath
+           << "  rows=" << r.rowCount;
+        if (!r.passed || r.blessed)
+            os << "  " << r.message;
+        os << "\n";
+        if (r.passed)
+            ++passed;
+    }
+    os << "[Replay] " << passed << "/" << results.size() << " passed\n";
+}
+
+// Gercek deger: tum ornekler listener'dan gecirilir, sorgu anindaki deger iki ornek arasinda dogrusal.
+// Tahmin: sadece sorgu aninda sim'e ulasmis ornekleri gormus listener'in latest state'i.
+template<typename Listener, typename DeviceState>
+static PredictionErrorStats EvaluateWith(Listener& truthListener, Listener& listener, const std::vector<InputSample>& samples,
+    const PredictionConfig& config, const PredictionEvalOptions& options)
+{
+    PredictionErrorStats stats;
+    stats.model = config.model;
+    stats.latencyNs = options.latencyNs;
+    if (samples.size() < 2 || options.queryPeriodNs <= 0)
+        return stats;
+
+    DeviceState state;
+    std::vector<JoystickState> truth;
+    truth.reserve(samples.size());
+    for (const InputSample& sample : samples)
+    {
+        Listener::FromSample(sample, state);
+        truthListener.ProcessState(state, sample.timestampNs);
+        truth.push_back(truthListener.GetLatestState());
+    }
+
+    double sumSq[JoystickState::MaxAxes] = {};
+    double holdSumSq[JoystickState::MaxAxes] = {};
+    size_t next = 0;
+    size_t bracket = 0;
+
+    for (int64_t t = samples.front().timestampNs; t <= samples.back().timestampNs; t += options.queryPeriodNs)
+    {
+        while (next < samples.size() && samples[next].timestampNs <= t - options.latencyNs)
+        {
+            Listener::FromSample(samples[next], state);
+            listener.ProcessState(state, samples[next].timestampNs);
+            ++next;
+        }
+        if (next == 0)
+            continue;
+
+        while (bracket + 1 < truth.size() && truth[bracket + 1].timestampNs <= t)
+            ++bracket;
+        const JoystickState& a = truth[bracket];
+        const JoystickState& b = truth[bracket + 1 < truth.size() ? bracket + 1 : bracket];
+        const double span = static_cast<double>(b.timestampNs - a.timestampNs);
+        const double w = span > 0.0 ? static_cast<double>(t - a.timestampNs) / span : 0.0;
+
+        const JoystickState latest = listener.GetLatestState();
+        stats.axisCount = latest.axisCount;
+        ++stats.queryCount;
+
+        for (int axis = 0; axis < latest.axisCount && axis < JoystickState::MaxAxes; ++axis)
+        {
+            const double actual = a.axes[axis] + (b.axes[axis] - a.axes[axis]) * w;
+            const double err = CAxisPredictor::Predict(latest, axis, t, config, true) - actual;
+            const double holdErr = latest.axes[axis] - actual;
+
+            sumSq[axis] += err * err;
+            holdSumSq[axis] += holdErr * holdErr;
+            if (std::fabs(err) > stats.maxAbs[axis])
+                stats.maxAbs[axis] = std::fabs(err);
+        }
+    }
+
+    for (int axis = 0; axis < stats.axisCount; ++axis)
+    {
+        stats.rms[axis] = stats.queryCount ? std::sqrt(sumSq[axis] / stats.queryCount) : 0.0;
+        stats.holdRms[axis] = stats.queryCount ? std::sqrt(holdSumSq[axis] / stats.queryCount) : 0.0;
+    }
+    return stats;
+}
+
+PredictionErrorStats CReplayHarness::EvaluatePrediction(const CInputSession& session, const PredictionConfig& config,
+    const PredictionEvalOptions& options)
+{
+    PredictionConfig enabled = config;
+    enabled.enabled = true;
+
+    if (session.GetDeviceKind() == InputDeviceKind::DirectInput)
+    {
+        CJoystickListenerDI truthListener(GUID{});
+        CJoystickListenerDI listener(GUID{});
+        for (CJoystickListenerDI* l : { &truthListener, &listener })
+        {
+            l->SetNormalize(true);
+            l->ResetState();
+        }
+        listener.SetPrediction(enabled);
+        return EvaluateWith<CJoystickListenerDI, DIJOYSTATE2>(truthListener, listener, session.GetSamples(), enabled, options);
+    }
+
+    CJoystickListener truthListener(0);
+    CJoystickListener listener(0);
+    for (CJoystickListener* l : { &truthListener, &listener })
+    {
+        l->SetNormalize(true);
+        l->ResetState();
+    }
+    listener.SetPrediction(enabled);
+    return EvaluateWith<CJoystickListener, JOYINFOEX>(truthListener, listener, session.GetSamples(), enabled, options);
+}
+
+void PredictionErrorStats::Print(std::ostream& os, const std::string& name) const
+{
+    os << "[Prediction] " << name << "  model : " << PredictionModelName(model)
+       << "  latency : " << latencyNs / 1000 << " us  queries : " << queryCount << "\n";
+    for (int axis = 0; axis < axisCount; ++axis)
+    {
+        os << "  axis " << axis << std::scientific << std::setprecision(3)
+           << "  rms : " << rms[axis]
+           << "  max : " << maxAbs[axis]
+           << "  holdRms : " << holdRms[axis] << std::defaultfloat << "\n";
+    }
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <iostream>
+
+#include "InputSession.h"
+#include "AxisPredictor.h"
+
+// Sanal saatte bir tick'te CAircraft'tan alinan durum satiri.
+struct TrajectoryRow
+{
+    enum Column
+    {
+        ColIterCount = 0,
+        ColRollCmd,
+        ColPitchCmd,
+        ColYawCmd,
+        ColThrottleCmd,
+        ColRoll,
+        ColPitch,
+        ColYaw,
+        ColThrottle,
+        ColHeading,
+        ColLatitude,
+        ColLongitude,
+        ColAltitude,
+        ColSpeed,
+        ColumnCount
+    };
+
+    static const char* ColumnName(int column);
+
+    int64_t timeNs;
+    double  values[ColumnCount];
+};
+
+struct ReplayOptions
+{
+    int64_t tickPeriodNs = 1000000;     // sim tick'i (1 ms), canli donguyle ayni
+    double  absTolerance = 1e-9;
+    double  relTolerance = 1e-9;
+    bool    updateGolden = false;       // true ise golden dosyalar yeniden yazilir (bless)
+    int     threadCount = 0;            // 0: hardware_concurrency
+};
+
+struct ReplayResult
+{
+    std::string sessionPath;
+    std::string goldenPath;
+    bool        passed = false;
+    bool        blessed = false;
+    size_t      rowCount = 0;
+    std::string message;                // ilk uyusmazlik veya hata
+};
+
+struct PredictionEvalOptions
+{
+    int64_t queryPeriodNs = 1000000;    // sim tick'i
+    int64_t latencyNs = 0;              // ornegin sim'e ulasmasina kadar ek gecikme (poll yasi haric)
+};
+
+// Her tick'te tahmin edilen eksen degeri ile kayittaki (iki ornek arasi dogrusal) gercek degerin farki.
+struct PredictionErrorStats
+{
+    PredictionModel model = PredictionModel::Hold;
+    int64_t latencyNs = 0;
+    size_t  queryCount = 0;
+    int     axisCount = 0;
+    double  rms[JoystickState::MaxAxes] = {};
+    double  maxAbs[JoystickState::MaxAxes] = {};
+    double  holdRms[JoystickState::MaxAxes] = {};   // ayni sorgularda son ornegi kullanmanin hatasi
+
+    void Print(std::ostream& os, const std::string& name) const;
+};
+
+// Kayitli oturumlari sanal saatle listener -> CAircraft hattindan gecirip
+// cikan yorungeyi golden CSV ile karsilastirir. Gercek thread, pacer veya
+// cihaz kullanilmaz; ayni oturum her calistirmada ayni yorungeyi verir.
+class CReplayHarness
+{
+public:
+    explicit CReplayHarness(const ReplayOptions& options = ReplayOptions());
+
+    static std::vector<TrajectoryRow> Replay(const CInputSession& session, int64_t tickPeriodNs);
+
+    static bool WriteTrajectory(const std::string& filename, const std::vector<TrajectoryRow>& rows);
+    static bool ReadTrajectory(const std::string& filename, std::vector<TrajectoryRow>& rows);
+
+    // <session>.jlss icin golden dosyasi <session>.golden.csv
+    static std::string GoldenPathFor(const std::string& sessionPath);
+
+    ReplayResult RunCase(const std::string& sessionPath) const;
+
+    // Klasordeki tum .jlss oturumlarini is parcaciklarina dagitarak calistirir.
+    std::vector<ReplayResult> RunCorpus(const std::string& directory) const;
+
+    static void PrintSummary(std::ostream& os, const std::vector<ReplayResult>& results);
+
+    // Tahmin modelini kayitli oturum uzerinde olcer (normalize eksenler); ayar icin.
+    static PredictionErrorStats EvaluatePrediction(const CInputSession& session, const PredictionConfig& config,
+        const PredictionEvalOptions& options = PredictionEvalOptions());
+
+private:
+    bool Compare(const std::vector<TrajectoryRow>& actual, const std::vector<TrajectoryRow>& expected, std::string& message) const;
+
+    ReplayOptions m_options;
+};
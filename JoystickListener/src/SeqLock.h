@@ -0,0 +1,108 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define JL_SEQLOCK_RELAX() _mm_pause()
+#elif defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define JL_SEQLOCK_RELAX() _mm_pause()
+#else
+#define JL_SEQLOCK_RELAX() ((void)0)
+#endif
+
+// Kucuk, trivially copyable bir degeri yirtilmadan yayinlamak icin seqlock.
+// Yazarlar sirayi tek sayiya CAS'layarak birbirini dislar (yazici sayisi az, sure kisa);
+// okuyucu hic yazmaz, yazari hic bekletmez ve sadece yarisa denk gelirse tekrar dener.
+template<typename T>
+class CSeqLock
+{
+    static_assert(std::is_trivially_copyable<T>::value, "CSeqLock requires a trivially copyable type");
+
+public:
+    CSeqLock()
+        : m_sequence(0)
+    {
+        for (auto& word : m_words)
+            word.store(0, std::memory_order_relaxed);
+    }
+
+    // fn(T&) mevcut deger uzerinde degisiklik yapar (alan birlestirme icin).
+    template<typename Fn>
+    void Modify(Fn fn)
+    {
+        uint64_t seq = m_sequence.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            if ((seq & 1) == 0 &&
+                m_sequence.compare_exchange_weak(seq, seq + 1, std::memory_order_acquire, std::memory_order_relaxed))
+                break;
+            JL_SEQLOCK_RELAX();
+            seq = m_sequence.load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_release);
+
+        T value;
+        LoadWords(value);
+        fn(value);
+        StoreWords(value);
+
+        m_sequence.store(seq + 2, std::memory_order_release);
+    }
+
+    void Store(const T& value)
+    {
+        Modify([&value](T& current) { current = value; });
+    }
+
+    // Tutarli bir kopya okur, okunan sira numarasini dondurur (her zaman cift).
+    uint64_t Load(T& out) const
+    {
+        for (;;)
+        {
+            uint64_t before = m_sequence.load(std::memory_order_acquire);
+            if (before & 1)
+            {
+                JL_SEQLOCK_RELAX();
+                continue;
+            }
+            LoadWords(out);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (m_sequence.load(std::memory_order_relaxed) == before)
+                return before;
+        }
+    }
+
+    uint64_t GetSequence(void) const
+    {
+        return m_sequence.load(std::memory_order_acquire);
+    }
+
+private:
+    static const size_t WordCount = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    // Veri, relaxed atomik kelimeler uzerinden kopyalanir; boylece yaris
+    // dilin modelinde tanimli kalir.
+    void LoadWords(T& out) const
+    {
+        uint64_t tmp[WordCount];
+        for (size_t i = 0; i < WordCount; ++i)
+            tmp[i] = m_words[i].load(std::memory_order_relaxed);
+        std::memcpy(&out, tmp, sizeof(T));
+    }
+
+    void StoreWords(const T& value)
+    {
+        uint64_t tmp[WordCount] = {};
+        std::memcpy(tmp, &value, sizeof(T));
+        for (size_t i = 0; i < WordCount; ++i)
+            m_words[i].store(tmp[i], std::memory_order_relaxed);
+    }
+
+    alignas(64) std::atomic<uint64_t> m_sequence;
+    std::atomic<uint64_t> m_words[WordCount];
+};
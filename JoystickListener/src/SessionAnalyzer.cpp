@@ -0,0 +1,387 @@
+#include "SessionAnalyzer.h"
+#include "InputSession.h"
+#include "LoopPacer.h"
+#include "MappedFile.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <filesystem>
+#include <iomanip>
+#include <memory>
+#include <thread>
+
+namespace
+{
+    enum class RecordingKind
+    {
+        Session,
+        Flight
+    };
+
+    // Eslenmis dosya; analiz boyunca acik kalir, thread'ler yalnizca okur
+    struct Recording
+    {
+        RecordingKind kind = RecordingKind::Session;
+        CMappedFile file;
+        const InputSample* samples = nullptr;
+        uint64_t sampleCount = 0;
+        int axisCount = 0;
+        CFlightDataReader flight;
+    };
+
+    // Session: ornek araligi, Flight: blok araligi
+    struct Partition
+    {
+        size_t   recording;
+        uint64_t begin;
+        uint64_t end;
+    };
+
+    bool HasExtension(const std::string& path, const char* extension)
+    {
+        return std::filesystem::path(path).extension() == extension;
+    }
+
+    void AddHold(SessionAnalysis& out, int button, int64_t durationNs)
+    {
+        out.heldNs[button] += durationNs;
+        out.maxHoldNs[button] = std::max(out.maxHoldNs[button], durationNs);
+        out.holdNs.Add(static_cast<double>(durationNs));
+    }
+
+    // Basis, basma kenarinin dustugu bolume aittir. Bolum sonunda basili kalanlar icin
+    // birakilana kadar sonraki orneklere bakilir; oncesinde baslayan basislarin birakilmasi yok sayilir.
+    void AnalyzeSessionRange(const Recording& rec, uint64_t begin, uint64_t end, SessionAnalysis& out)
+    {
+        const InputSample* samples = rec.samples;
+        const InputSample released = {};    // dosyanin ilk orneginden once: hepsi birakilmis
+        const InputSample* prev = begin ? &samples[begin - 1] : &released;
+
+        int64_t pressStart[SessionAnalysis::MaxButtons];
+        uint32_t open[4] = {};
+
+        out.samples += end - begin;
+        out.durationNs += samples[end - 1].timestampNs - samples[begin ? begin - 1 : 0].timestampNs;
+
+        for (uint64_t i = begin; i < end; ++i)
+        {
+            const InputSample& cur = samples[i];
+            if (i > 0)
+                out.sampleIntervalNs.Add(static_cast<double>(cur.timestampNs - prev->timestampNs));
+
+            for (int a = 0; a < rec.axisCount; ++a)
+            {
+                out.axes[a].Add(cur.axes[a]);
+                out.axisChanges += cur.axes[a] != prev->axes[a];
+            }
+            for (int p = 0; p < 4; ++p)
+                out.povChanges += cur.pov[p] != prev->pov[p];
+
+            for (int w = 0; w < 4; ++w)
+            {
+                uint32_t changed = cur.buttons[w] ^ prev->buttons[w];
+                out.buttonEdges += std::popcount(changed);
+                while (changed)
+                {
+                    const uint32_t bit = changed & (0u - changed);
+                    const int button = w * 32 + std::countr_zero(changed);
+                    changed &= changed - 1;
+
+                    if (cur.buttons[w] & bit)
+                    {
+                        ++out.pressCount[button];
+                        pressStart[button] = cur.timestampNs;
+                        open[w] |= bit;
+                    }
+                    else if (open[w] & bit)
+                    {
+                        AddHold(out, button, cur.timestampNs - pressStart[button]);
+                        open[w] &= ~bit;
+                    }
+                }
+            }
+            prev = &cur;
+        }
+
+        for (uint64_t i = end; i < rec.sampleCount && (open[0] | open[1] | open[2] | open[3]); ++i)
+        {
+            for (int w = 0; w < 4; ++w)
+            {
+                uint32_t up = open[w] & ~samples[i].buttons[w];
+                open[w] &= ~up;
+                while (up)
+                {
+                    const int button = w * 32 + std::countr_zero(up);
+                    up &= up - 1;
+                    AddHold(out, button, samples[i].timestampNs - pressStart[button]);
+                }
+            }
+        }
+
+        for (int w = 0; w < 4; ++w)
+            out.unreleasedPresses += std::popcount(open[w]);
+    }
+
+    void AnalyzeFlightRange(const Recording& rec, uint64_t begin, uint64_t end, FlightBlockData& data, SessionAnalysis& out)
+    {
+        const std::vector<FlightBlockInfo>& blocks = rec.flight.GetBlocks();
+        const int64_t startNs = begin ? blocks[begin - 1].lastNs : blocks[0].firstNs;
+        int64_t prevNs = startNs;
+        bool hasPrev = begin > 0;
+
+        for (uint64_t b = begin; b < end; ++b)
+        {
+            if (!rec.flight.ReadBlock(static_cast<size_t>(b), CFlightDataReader::AllColumns, data))
+            {
+                hasPrev = false;
+                continue;
+            }
+
+            for (size_t i = 0; i < data.count; ++i)
+            {
+                const int64_t ts = data.timestampsNs[i];
+                if (hasPrev)
+                    out.frameIntervalNs.Add(static_cast<double>(ts - prevNs));
+                prevNs = ts;
+                hasPrev = true;
+            }
+            for (int c = 0; c < FlightColumnCount; ++c)
+            {
+                RunningStats& column = out.envelope[c];
+                for (double value : data.columns[c])
+                    column.Add(value);
+            }
+            out.flightFrames += data.count;
+        }
+
+        out.flightDurationNs += blocks[end - 1].lastNs - startNs;
+    }
+}
+
+SessionAnalysis::SessionAnalysis(const SessionAnalyzerConfig& config)
+    : sampleIntervalNs(config.quantileAccuracy),
+    holdNs(config.quantileAccuracy),
+    frameIntervalNs(config.quantileAccuracy)
+{
+    for (CLinearHistogram& axis : axes)
+        axis = CLinearHistogram(0.0, 65536.0, config.axisBins);
+}
+
+void SessionAnalysis::Merge(const SessionAnalysis& other)
+{
+    sessionFiles += other.sessionFiles;
+    flightFiles += other.flightFiles;
+    skippedFiles += other.skippedFiles;
+    bytes += other.bytes;
+    partitions += other.partitions;
+
+    samples += other.samples;
+    durationNs += other.durationNs;
+    axisChanges += other.axisChanges;
+    povChanges += other.povChanges;
+    buttonEdges += other.buttonEdges;
+    for (int a = 0; a < MaxAxes; ++a)
+        axes[a].Merge(other.axes[a]);
+    sampleIntervalNs.Merge(other.sampleIntervalNs);
+
+    for (int b = 0; b < MaxButtons; ++b)
+    {
+        pressCount[b] += other.pressCount[b];
+        heldNs[b] += other.heldNs[b];
+        maxHoldNs[b] = std::max(maxHoldNs[b], other.maxHoldNs[b]);
+    }
+    unreleasedPresses += other.unreleasedPresses;
+    holdNs.Merge(other.holdNs);
+
+    flightFrames += other.flightFrames;
+    flightDurationNs += other.flightDurationNs;
+    for (int c = 0; c < FlightColumnCount; ++c)
+        envelope[c].Merge(other.envelope[c]);
+    frameIntervalNs.Merge(other.frameIntervalNs);
+}
+
+static void PrintSketch(std::ostream& os, const char* label, const CQuantileSketch& s, double unitNs, const char* unit)
+{
+    os << "  " << std::left << std::setw(16) << label << std::right
+       << " n : "     << std::setw(10) << s.Count()
+       << "  mean : " << std::setw(9) << s.Mean() / unitNs
+       << "  p50 : "  << std::setw(9) << s.Quantile(0.50) / unitNs
+       << "  p99 : "  << std::setw(9) << s.Quantile(0.99) / unitNs
+       << "  p99.9 : " << std::setw(9) << s.Quantile(0.999) / unitNs
+       << "  max : "  << std::setw(9) << s.Max() / unitNs << " " << unit << "\n";
+}
+
+void SessionAnalysis::Print(std::ostream& os) const
+{
+    const double seconds = durationNs * 1e-9;
+    const double megabytes = bytes / (1024.0 * 1024.0);
+
+    os << std::fixed << std::setprecision(2);
+    os << "[SessionAnalyzer] files : " << sessionFiles << " session + " << flightFiles << " flight"
+       << " (skipped " << skippedFiles << ")  data : " << megabytes << " MB"
+       << "  partitions : " << partitions << "  time : " << elapsedMs << " ms";
+    if (elapsedMs > 0.0)
+        os << "  (" << megabytes / (elapsedMs * 1e-3) << " MB/s)";
+    os << "\n";
+
+    if (samples)
+    {
+        os << "  samples : " << samples << "  duration : " << seconds << " s";
+        if (seconds > 0.0)
+            os << "  rate : " << samples / seconds << " Hz"
+               << "  axisChanges : " << axisChanges / seconds << " /s"
+               << "  buttonEdges : " << buttonEdges / seconds << " /s"
+               << "  povChanges : " << povChanges / seconds << " /s";
+        os << "\n";
+        PrintSketch(os, "sampleInterval", sampleIntervalNs, 1e3, "us");
+        PrintSketch(os, "hold", holdNs, 1e6, "ms");
+        os << "  unreleased : " << unreleasedPresses << "\n";
+
+        for (int a = 0; a < MaxAxes; ++a)
+        {
+            if (!axes[a].Count())
+                continue;
+            os << "  axis " << a << "  p5 : " << std::setw(8) << axes[a].Quantile(0.05)
+               << "  p50 : " << std::setw(8) << axes[a].Quantile(0.50)
+               << "  p95 : " << std::setw(8) << axes[a].Quantile(0.95)
+               << "  |" << axes[a].Sparkline() << "|\n";
+        }
+
+        for (int b = 0; b < MaxButtons; ++b)
+        {
+            if (!pressCount[b])
+                continue;
+            os << "  button " << std::setw(3) << b << "  presses : " << std::setw(8) << pressCount[b]
+               << "  held : " << std::setw(9) << heldNs[b] * 1e-9 << " s"
+               << "  maxHold : " << std::setw(9) << maxHoldNs[b] * 1e-6 << " ms\n";
+        }
+    }
+
+    if (flightFrames)
+    {
+        os << "  flightFrames : " << flightFrames << "  flightDuration : " << flightDurationNs * 1e-9 << " s\n";
+        PrintSketch(os, "frameInterval", frameIntervalNs, 1e6, "ms");
+        for (int c = 0; c < FlightColumnCount; ++c)
+        {
+            os << "  " << std::left << std::setw(12) << FlightColumnName(c) << std::right
+               << " min : "   << std::setw(14) << envelope[c].min
+               << "  max : "  << std::setw(14) << envelope[c].max
+               << "  mean : " << std::setw(14) << envelope[c].Mean() << "\n";
+        }
+    }
+}
+
+CSessionAnalyzer::CSessionAnalyzer(const SessionAnalyzerConfig& config)
+    : m_config(config)
+{
+}
+
+SessionAnalysis CSessionAnalyzer::Analyze(const std::vector<std::string>& paths) const
+{
+    const int64_t startNs = CLoopPacer::NowNs();
+    SessionAnalysis result(m_config);
+
+    // Tum dosyalar baslangicta eslenir (64 bit adres alani); sayfalar okundukca gelir
+    std::vector<std::unique_ptr<Recording>> recordings;
+    std::vector<Partition> partitions;
+    for (const std::string& path : paths)
+    {
+        std::unique_ptr<Recording> rec = std::make_unique<Recording>();
+        if (!rec->file.Open(path))
+        {
+            ++result.skippedFiles;
+            continue;
+        }
+
+        const uint8_t* data = rec->file.Data();
+        const size_t size = rec->file.Size();
+        uint64_t units = 0;
+        uint64_t step = 0;
+
+        InputDeviceKind kind;
+        if (HasExtension(path, ".jlss") && CInputSession::ParseHeader(data, size, kind, rec->sampleCount))
+        {
+            rec->kind = RecordingKind::Session;
+            rec->samples = reinterpret_cast<const InputSample*>(data + CInputSession::HeaderSize);
+            rec->axisCount = (kind == InputDeviceKind::WinMM) ? 6 : SessionAnalysis::MaxAxes;
+            units = rec->sampleCount;
+            step = std::max<uint64_t>(m_config.samplesPerPartition, 1);
+            ++result.sessionFiles;
+        }
+        else if (HasExtension(path, ".jlfd") && rec->flight.Open(data, size))
+        {
+            rec->kind = RecordingKind::Flight;
+            units = rec->flight.GetBlocks().size();
+            step = static_cast<uint64_t>(std::max(m_config.blocksPerPartition, 1));
+            ++result.flightFiles;
+        }
+        else
+        {
+            ++result.skippedFiles;
+            continue;
+        }
+
+        result.bytes += size;
+        for (uint64_t begin = 0; begin < units; begin += step)
+            partitions.push_back({ recordings.size(), begin, std::min(begin + step, units) });
+        recordings.push_back(std::move(rec));
+    }
+
+    int threadCount = m_config.threadCount > 0 ? m_config.threadCount : static_cast<int>(std::thread::hardware_concurrency());
+    threadCount = std::clamp(threadCount, 1, static_cast<int>(std::max<size_t>(partitions.size(), 1)));
+
+    std::vector<SessionAnalysis> partials(static_cast<size_t>(threadCount), SessionAnalysis(m_config));
+    std::atomic<size_t> next(0);
+
+    auto worker = [&](int index)
+    {
+        SessionAnalysis& out = partials[static_cast<size_t>(index)];
+        FlightBlockData data;
+        for (size_t p = next.fetch_add(1, std::memory_order_relaxed); p < partitions.size();
+             p = next.fetch_add(1, std::memory_order_relaxed))
+        {
+            const Partition& part = partitions[p];
+            const Recording& rec = *recordings[part.recording];
+            if (rec.kind == RecordingKind::Session)
+            {
+                rec.file.Prefetch(CInputSession::HeaderSize + part.begin * sizeof(InputSample),
+                    (part.end - part.begin) * sizeof(InputSample));
+                AnalyzeSessionRange(rec, part.begin, part.end, out);
+            }
+            else
+            {
+                AnalyzeFlightRange(rec, part.begin, part.end, data, out);
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int t = 1; t < threadCount; ++t)
+        threads.emplace_back(worker, t);
+    worker(0);
+    for (std::thread& thread : threads)
+        thread.join();
+
+    for (const SessionAnalysis& partial : partials)
+        result.Merge(partial);
+    result.partitions = partitions.size();
+    result.elapsedMs = (CLoopPacer::NowNs() - startNs) * 1e-6;
+    return result;
+}
+
+std::vector<std::string> CSessionAnalyzer::FindRecordings(const std::string& directory)
+{
+    std::vector<std::string> paths;
+    std::error_code error;
+    for (std::filesystem::recursive_directory_iterator it(directory, error), end; !error && it != end; it.increment(error))
+    {
+        if (!it->is_regular_file(error))
+            continue;
+        const std::string path = it->path().string();
+        if (HasExtension(path, ".jlss") || HasExtension(path, ".jlfd"))
+            paths.push_back(path);
+    }
+    std::sort(paths.begin(), paths.end());
+    return paths;
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "FlightDataRecorder.h"
+#include "MergeableStats.h"
+
+struct SessionAnalyzerConfig
+{
+    int      threadCount = 0;                   // 0: hardware_concurrency
+    uint64_t samplesPerPartition = 1 << 18;     // .jlss bolum boyu (~18 MB)
+    int      blocksPerPartition = 64;           // .jlfd bolum boyu
+    double   quantileAccuracy = 0.01;           // CQuantileSketch goreli hatasi
+    int      axisBins = 64;
+};
+
+// Kayitlarin toplu istatistikleri. Her bolum kendi kopyasini doldurur, Merge ile toplanir.
+struct SessionAnalysis
+{
+    static const int MaxAxes = 8;
+    static const int MaxButtons = 128;
+
+    explicit SessionAnalysis(const SessionAnalyzerConfig& config = SessionAnalyzerConfig());
+
+    void Merge(const SessionAnalysis& other);
+    void Print(std::ostream& os) const;
+
+    // Kaynak
+    uint64_t sessionFiles = 0;
+    uint64_t flightFiles = 0;
+    uint64_t skippedFiles = 0;
+    uint64_t bytes = 0;
+    uint64_t partitions = 0;
+    double   elapsedMs = 0.0;
+
+    // .jlss oturumlari
+    uint64_t samples = 0;
+    int64_t  durationNs = 0;                    // dosya basina ilk..son ornek, toplam
+    uint64_t axisChanges = 0;                   // degisen eksen x ornek
+    uint64_t povChanges = 0;
+    uint64_t buttonEdges = 0;
+    CLinearHistogram axes[MaxAxes];             // ham deger 0..65535
+    CQuantileSketch  sampleIntervalNs;          // ardisik ornekler arasi (poll araligi / jitter)
+
+    // KeyHistory ile ayni anlam: basis sayisi ve basili kalma suresi
+    uint64_t pressCount[MaxButtons] = {};
+    int64_t  heldNs[MaxButtons] = {};
+    int64_t  maxHoldNs[MaxButtons] = {};
+    uint64_t unreleasedPresses = 0;             // dosya sonunda hala basili
+    CQuantileSketch holdNs;
+
+    // .jlfd ucus kayitlari
+    uint64_t flightFrames = 0;
+    int64_t  flightDurationNs = 0;
+    RunningStats envelope[FlightColumnCount];   // sutun basina min/max/ortalama
+    CQuantileSketch frameIntervalNs;
+};
+
+// Kayit dosyalarini (.jlss oturum, .jlfd ucus) esleyip bolumlere ayirir; bolumler thread'lere
+// dagitilir. Her thread kendi SessionAnalysis'ini biriktirir, sonunda tek thread'de birlestirilir.
+// Dosyalar sirayla bolumlendigi icin thread'ler ayni dosyanin komsu araliklarini okur.
+class CSessionAnalyzer
+{
+public:
+    explicit CSessionAnalyzer(const SessionAnalyzerConfig& config = SessionAnalyzerConfig());
+
+    SessionAnalysis Analyze(const std::vector<std::string>& paths) const;
+
+    // Dizindeki (alt dizinler dahil) .jlss ve .jlfd dosyalari, sirali
+    static std::vector<std::string> FindRecordings(const std::string& directory);
+
+private:
+    SessionAnalyzerConfig m_config;
+};
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+// Sinirli, tek ureticili / tek tuketicili kilitsiz kuyruk.
+// Kapasite 2'nin kuvvetine yuvarlanir; dolu kuyrukta TryPush false doner.
+template<typename T>
+class CSpscQueue
+{
+public:
+    explicit CSpscQueue(size_t capacity)
+        : m_head(0), m_tail(0), m_cachedHead(0), m_cachedTail(0)
+    {
+        size_t size = 1;
+        while (size < capacity)
+            size <<= 1;
+        m_mask = size - 1;
+        m_items.resize(size);
+    }
+
+    // Uretici tarafi
+    bool TryPush(const T& item)
+    {
+        const size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail - m_cachedHead > m_mask)
+        {
+            m_cachedHead = m_head.load(std::memory_order_acquire);
+            if (tail - m_cachedHead > m_mask)
+                return false;
+        }
+        m_items[tail & m_mask] = item;
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Tuketici tarafi
+    bool TryPop(T& item)
+    {
+        const size_t head = m_head.load(std::memory_order_relaxed);
+        if (head == m_cachedTail)
+        {
+            m_cachedTail = m_tail.load(std::memory_order_acquire);
+            if (head == m_cachedTail)
+                return false;
+        }
+        item = m_items[head & m_mask];
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Herhangi bir thread'den okunabilir; anlik (yaklasik) doluluk.
+    // head once okunur: tail ondan geri kalamaz, fark eksiye sarmaz. Arada ilerleyen
+    // tail farki kapasiteyi asirabilecegi icin sinirlanir.
+    size_t Size(void) const
+    {
+        const size_t head = m_head.load(std::memory_order_acquire);
+        const size_t tail = m_tail.load(std::memory_order_acquire);
+        const size_t size = tail - head;
+        return size < Capacity() ? size : Capacity();
+    }
+
+    size_t Capacity(void) const
+    {
+        return m_mask + 1;
+    }
+
+private:
+    std::vector<T> m_items;
+    size_t m_mask;
+
+    alignas(64) std::atomic<size_t> m_head;
+    alignas(64) std::atomic<size_t> m_tail;
+    alignas(64) size_t m_cachedHead;    // uretici kopyasi
+    alignas(64) size_t m_cachedTail;    // tuketici kopyasi
+};
@@ -0,0 +1,271 @@
+#include "SyntheticInputSource.h"
+#include "LoopPacer.h"
+#include "TraceRecorder.h"
+
+#include <cmath>
+#include <cstring>
+#include <iomanip>
+
+static const double TwoPi = 6.283185307179586;
+
+CSyntheticInputSource::CSyntheticInputSource(const SyntheticInputConfig& config)
+    : m_config(config),
+    m_running(false),
+    m_samples(config.queueCapacity),
+    m_keys(config.queueCapacity),
+    m_rng(config.seed ? config.seed : 1),
+    m_startNs(0),
+    m_elapsedNs(0),
+    m_samplesGenerated(0),
+    m_samplesDropped(0),
+    m_keysGenerated(0),
+    m_keysDropped(0),
+    m_sampleQueueMaxDepth(0),
+    m_keyQueueMaxDepth(0),
+    m_samplesConsumed(0),
+    m_keysConsumed(0)
+{
+    std::memset(m_buttons, 0, sizeof(m_buttons));
+    std::memset(m_keyDown, 0, sizeof(m_keyDown));
+}
+
+CSyntheticInputSource::~CSyntheticInputSource()
+{
+    Stop();
+}
+
+void CSyntheticInputSource::Start(void)
+{
+    if (m_running)
+        return;
+
+    m_running = true;
+    m_thread = std::thread(&CSyntheticInputSource::GenerateLoop, this);
+}
+
+void CSyntheticInputSource::Stop(void)
+{
+    m_running = false;
+    if (m_thread.joinable() && std::this_thread::get_id() != m_thread.get_id())
+        m_thread.join();
+}
+
+bool CSyntheticInputSource::IsRunning(void) const
+{
+    return m_running;
+}
+
+const SyntheticInputConfig& CSyntheticInputSource::GetConfig(void) const
+{
+    return m_config;
+}
+
+void CSyntheticInputSource::GenerateLoop(void)
+{
+    JL_TRACE_THREAD("SyntheticInput");
+
+    const int64_t sampleIntervalNs = m_config.sampleRateHz > 0.0 ? static_cast<int64_t>(1e9 / m_config.sampleRateHz) : 0;
+    const int64_t keyIntervalNs = m_config.keyFloodRateHz > 0.0 ? static_cast<int64_t>(1e9 / m_config.keyFloodRateHz) : 0;
+
+    CLoopPacer pacer(m_config.tickPeriod, std::chrono::microseconds(50));
+    m_startNs = CLoopPacer::NowNs();
+    int64_t nextSampleNs = m_startNs;
+    int64_t nextKeyNs = m_startNs;
+
+    while (m_running)
+    {
+        const int64_t now = CLoopPacer::NowNs();
+
+        // Zaman damgasi ideal uretim ani; uretici geride kalirsa gecikme olarak gorunur.
+        while (sampleIntervalNs > 0 && nextSampleNs <= now)
+        {
+            InputSample sample;
+            MakeSample(nextSampleNs, sample);
+            Bump(m_samplesGenerated);
+            if (!m_samples.TryPush(sample))
+                Bump(m_samplesDropped);
+            nextSampleNs += sampleIntervalNs;
+        }
+
+        while (keyIntervalNs > 0 && nextKeyNs <= now)
+        {
+            const int range = m_config.keyLast - m_config.keyFirst + 1;
+            int vk = m_config.keyFirst + static_cast<int>(NextRandom() % static_cast<uint64_t>(range > 0 ? range : 1));
+            if (vk > 0 && vk < 255 && vk != 27)
+            {
+                m_keyDown[vk] = !m_keyDown[vk];
+                SyntheticKeyEvent event{ nextKeyNs, vk, m_keyDown[vk] };
+                Bump(m_keysGenerated);
+                if (!m_keys.TryPush(event))
+                {
+                    // Dusen olay tuketicinin gordugu durumu bozmasin
+                    m_keyDown[vk] = !m_keyDown[vk];
+                    Bump(m_keysDropped);
+                }
+            }
+            nextKeyNs += keyIntervalNs;
+        }
+
+        const size_t sampleDepth = m_samples.Size();
+        if (sampleDepth > m_sampleQueueMaxDepth.load(std::memory_order_relaxed))
+            m_sampleQueueMaxDepth.store(sampleDepth, std::memory_order_relaxed);
+        const size_t keyDepth = m_keys.Size();
+        if (keyDepth > m_keyQueueMaxDepth.load(std::memory_order_relaxed))
+            m_keyQueueMaxDepth.store(keyDepth, std::memory_order_relaxed);
+
+        m_elapsedNs.store(now - m_startNs, std::memory_order_relaxed);
+
+        pacer.Wait();
+    }
+}
+
+void CSyntheticInputSource::MakeSample(int64_t timestampNs, InputSample& sample)
+{
+    const double t = static_cast<double>(timestampNs - m_startNs) * 1e-9;
+
+    sample.timestampNs = timestampNs;
+    for (int i = 0; i < 8; ++i)
+    {
+        double v = AxisValue(m_config.axes[i], t);
+        v = v < -1.0 ? -1.0 : (v > 1.0 ? 1.0 : v);
+        sample.axes[i] = static_cast<int32_t>((v + 1.0) * 32767.5);
+    }
+
+    sample.pov[0] = sample.pov[1] = sample.pov[2] = sample.pov[3] = 0xFFFFFFFF;
+
+    // Buton firtinasi: ortalama buttonStormRateHz / sampleRateHz degisim / ornek
+    if (m_config.buttonStormRateHz > 0.0 && m_config.buttonCount > 0)
+    {
+        double expected = m_config.buttonStormRateHz / m_config.sampleRateHz;
+        int toggles = static_cast<int>(expected);
+        if (NextUniform() < expected - toggles)
+            ++toggles;
+
+        const int count = m_config.buttonCount > 128 ? 128 : m_config.buttonCount;
+        for (int k = 0; k < toggles; ++k)
+        {
+            int b = static_cast<int>(NextRandom() % static_cast<uint64_t>(count));
+            m_buttons[b >> 5] ^= (1u << (b & 31));
+        }
+    }
+    std::memcpy(sample.buttons, m_buttons, sizeof(m_buttons));
+}
+
+double CSyntheticInputSource::AxisValue(const AxisWaveformConfig& axis, double t)
+{
+    switch (axis.waveform)
+    {
+    case AxisWaveform::Sine:
+        return axis.offset + axis.amplitude * std::sin(TwoPi * axis.frequencyHz * t + axis.phase);
+
+    case AxisWaveform::Step:
+        return axis.offset + axis.amplitude * ((static_cast<int64_t>(std::floor(t * axis.frequencyHz * 2.0)) & 1) ? 1.0 : -1.0);
+
+    case AxisWaveform::Noise:
+        return axis.offset + axis.amplitude * (NextUniform() * 2.0 - 1.0);
+
+    case AxisWaveform::Chirp:
+    {
+        const double duration = axis.chirpDurationS > 0.0 ? axis.chirpDurationS : 1.0;
+        const double tau = std::fmod(t, duration);
+        const double k = (axis.chirpEndHz - axis.frequencyHz) / duration;
+        return axis.offset + axis.amplitude * std::sin(TwoPi * (axis.frequencyHz * tau + 0.5 * k * tau * tau) + axis.phase);
+    }
+
+    case AxisWaveform::Constant:
+    default:
+        return axis.offset;
+    }
+}
+
+uint64_t CSyntheticInputSource::NextRandom(void)
+{
+    // xorshift64*
+    m_rng ^= m_rng >> 12;
+    m_rng ^= m_rng << 25;
+    m_rng ^= m_rng >> 27;
+    return m_rng * 0x2545F4914F6CDD1Dull;
+}
+
+double CSyntheticInputSource::NextUniform(void)
+{
+    return static_cast<double>(NextRandom() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+bool CSyntheticInputSource::PopSample(InputSample& sample)
+{
+    if (!m_samples.TryPop(sample))
+        return false;
+
+    const int64_t lag = CLoopPacer::NowNs() - sample.timestampNs;
+    m_sampleLag.Record(lag > 0 ? static_cast<uint64_t>(lag) : 0);
+    Bump(m_samplesConsumed);
+    return true;
+}
+
+bool CSyntheticInputSource::PopKeyEvent(SyntheticKeyEvent& event)
+{
+    if (!m_keys.TryPop(event))
+        return false;
+
+    const int64_t lag = CLoopPacer::NowNs() - event.timestampNs;
+    m_keyLag.Record(lag > 0 ? static_cast<uint64_t>(lag) : 0);
+    Bump(m_keysConsumed);
+    return true;
+}
+
+size_t CSyntheticInputSource::GetSampleQueueDepth(void) const
+{
+    return m_samples.Size();
+}
+
+size_t CSyntheticInputSource::GetKeyQueueDepth(void) const
+{
+    return m_keys.Size();
+}
+
+SyntheticSourceStats CSyntheticInputSource::GetStats(void) const
+{
+    SyntheticSourceStats stats;
+    stats.elapsedS = static_cast<double>(m_elapsedNs.load(std::memory_order_relaxed)) * 1e-9;
+    stats.samplesGenerated = m_samplesGenerated.load(std::memory_order_relaxed);
+    stats.samplesDropped = m_samplesDropped.load(std::memory_order_relaxed);
+    stats.samplesConsumed = m_samplesConsumed.load(std::memory_order_relaxed);
+    stats.keysGenerated = m_keysGenerated.load(std::memory_order_relaxed);
+    stats.keysDropped = m_keysDropped.load(std::memory_order_relaxed);
+    stats.keysConsumed = m_keysConsumed.load(std::memory_order_relaxed);
+    stats.queueCapacity = m_samples.Capacity();
+    stats.sampleQueueDepth = m_samples.Size();
+    stats.sampleQueueMaxDepth = m_sampleQueueMaxDepth.load(std::memory_order_relaxed);
+    stats.keyQueueDepth = m_keys.Size();
+    stats.keyQueueMaxDepth = m_keyQueueMaxDepth.load(std::memory_order_relaxed);
+    m_sampleLag.Read(stats.sampleLag, 1.0);
+    m_keyLag.Read(stats.keyLag, 1.0);
+    return stats;
+}
+
+static void PrintLag(std::ostream& os, const char* label, const HistogramSnapshot& h)
+{
+    os << "  " << label << " lag  n : " << h.count
+       << "  p50 : " << h.Percentile(0.50) / 1000.0
+       << "  p99 : " << h.Percentile(0.99) / 1000.0
+       << "  max : " << h.maxNs / 1000.0 << " us\n";
+}
+
+void SyntheticSourceStats::Print(std::ostream& os) const
+{
+    const double rate = elapsedS > 0.0 ? static_cast<double>(samplesGenerated) / elapsedS : 0.0;
+
+    os << "[Synthetic] " << (KeptUp() ? "kept up" : "FELL BEHIND")
+       << std::fixed << std::setprecision(1)
+       << "  elapsed : " << elapsedS << " s"
+       << "  sampleRate : " << rate << " Hz\n";
+    os << "  samples  generated : " << samplesGenerated << "  consumed : " << samplesConsumed
+       << "  dropped : " << samplesDropped
+       << "  depth : " << sampleQueueDepth << "/" << queueCapacity << " (max " << sampleQueueMaxDepth << ")\n";
+    os << "  keys     generated : " << keysGenerated << "  consumed : " << keysConsumed
+       << "  dropped : " << keysDropped
+       << "  depth : " << keyQueueDepth << "/" << queueCapacity << " (max " << keyQueueMaxDepth << ")\n";
+    PrintLag(os, "sample", sampleLag);
+    PrintLag(os, "key   ", keyLag);
+}
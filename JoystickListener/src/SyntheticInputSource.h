@@ -0,0 +1,140 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <iostream>
+#include <thread>
+#include <atomic>
+#include <chrono>
+
+#include "InputSession.h"
+#include "ListenerMetrics.h"
+#include "SpscQueue.h"
+
+enum class AxisWaveform
+{
+    Constant = 0,
+    Sine,
+    Step,       // kare dalga, frequencyHz ile -1/+1 arasinda
+    Noise,      // duzgun dagilimli gurultu
+    Chirp       // frequencyHz -> chirpEndHz, chirpDurationS suresince lineer tarama
+};
+
+// Normalize (-1..1) degerler uretilir, ham 0..65535 araligina cevrilir.
+struct AxisWaveformConfig
+{
+    AxisWaveform waveform = AxisWaveform::Constant;
+    double amplitude = 1.0;
+    double offset = 0.0;
+    double frequencyHz = 1.0;
+    double phase = 0.0;
+    double chirpEndHz = 50.0;
+    double chirpDurationS = 5.0;
+};
+
+struct SyntheticInputConfig
+{
+    double   sampleRateHz = 1000.0;         // joystick ornegi / saniye (on binlerce Hz olabilir)
+    AxisWaveformConfig axes[8];             // InputSample::axes sirasi
+    double   buttonStormRateHz = 0.0;       // saniyedeki rastgele buton degisimi
+    int      buttonCount = 128;
+    double   keyFloodRateHz = 0.0;          // saniyedeki rastgele tus olayi (Down/Up)
+    int      keyFirst = 'A';
+    int      keyLast = 'Z';                 // VK_ESCAPE (27) hic uretilmez
+    size_t   queueCapacity = 1 << 16;
+    std::chrono::microseconds tickPeriod = std::chrono::microseconds(250);
+    uint64_t seed = 0x9E3779B97F4A7C15ull;
+};
+
+struct SyntheticKeyEvent
+{
+    int64_t timestampNs;
+    int     vk;
+    bool    pressed;
+};
+
+struct SyntheticSourceStats
+{
+    double   elapsedS = 0.0;
+    uint64_t samplesGenerated = 0;
+    uint64_t samplesDropped = 0;
+    uint64_t samplesConsumed = 0;
+    uint64_t keysGenerated = 0;
+    uint64_t keysDropped = 0;
+    uint64_t keysConsumed = 0;
+    size_t   queueCapacity = 0;
+    size_t   sampleQueueDepth = 0;
+    size_t   sampleQueueMaxDepth = 0;
+    size_t   keyQueueDepth = 0;
+    size_t   keyQueueMaxDepth = 0;
+    HistogramSnapshot sampleLag;            // uretim -> listener'in isledigi an
+    HistogramSnapshot keyLag;
+
+    bool KeptUp(void) const { return samplesDropped == 0 && keysDropped == 0; }
+
+    void Print(std::ostream& os) const;
+};
+
+// Gercek cihaz yerine listener'lara baglanan sentetik girdi kaynagi.
+// Kendi thread'inde ornek ve tus olaylarini zaman damgasiyla uretip sinirli
+// SPSC kuyruklara koyar; kuyruk dolarsa olay dusurulur ve sayilir.
+// Her kuyrugun tek tuketicisi olmalidir (bir joystick ve bir klavye listener'i).
+class CSyntheticInputSource
+{
+public:
+    explicit CSyntheticInputSource(const SyntheticInputConfig& config = SyntheticInputConfig());
+    ~CSyntheticInputSource();
+
+    void Start(void);
+    void Stop(void);
+    bool IsRunning(void) const;
+
+    // Tuketici (listener thread'i) tarafi; gecikme burada olculur.
+    bool PopSample(InputSample& sample);
+    bool PopKeyEvent(SyntheticKeyEvent& event);
+    size_t GetSampleQueueDepth(void) const;
+    size_t GetKeyQueueDepth(void) const;
+
+    SyntheticSourceStats GetStats(void) const;
+    const SyntheticInputConfig& GetConfig(void) const;
+
+private:
+    void GenerateLoop(void);
+    void MakeSample(int64_t timestampNs, InputSample& sample);
+    double AxisValue(const AxisWaveformConfig& axis, double t);
+    uint64_t NextRandom(void);
+    double NextUniform(void);
+
+    static void Bump(std::atomic<uint64_t>& counter)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    SyntheticInputConfig m_config;
+
+    std::thread m_thread;
+    std::atomic<bool> m_running;
+
+    CSpscQueue<InputSample> m_samples;
+    CSpscQueue<SyntheticKeyEvent> m_keys;
+
+    // Uretici thread'ine ait durum
+    uint64_t m_rng;
+    int64_t  m_startNs;
+    uint32_t m_buttons[4];
+    bool     m_keyDown[256];
+
+    std::atomic<int64_t>  m_elapsedNs;
+    std::atomic<uint64_t> m_samplesGenerated;
+    std::atomic<uint64_t> m_samplesDropped;
+    std::atomic<uint64_t> m_keysGenerated;
+    std::atomic<uint64_t> m_keysDropped;
+    std::atomic<size_t>   m_sampleQueueMaxDepth;
+    std::atomic<size_t>   m_keyQueueMaxDepth;
+
+    // Tuketici thread'lerine ait
+    std::atomic<uint64_t> m_samplesConsumed;
+    std::atomic<uint64_t> m_keysConsumed;
+    CLatencyHistogram m_sampleLag;
+    CLatencyHistogram m_keyLag;
+};
@@ -0,0 +1,754 @@
+#include "TerminalKeyboard.h"
+#include "KeyNames.h"
+
+#include <array>
+#include <cstring>
+
+namespace
+{
+    // ASCII karakter -> VK | shift (bit 8); 0: tus yok
+    constexpr std::array<uint16_t, 128> MakeAsciiKeys()
+    {
+        std::array<uint16_t, 128> table{};
+        for (int vk = 1; vk < 256; ++vk)
+        {
+            const std::string_view name = KeyNames::Names[vk];
+            const std::string_view shifted = KeyNames::ShiftedNames[vk];
+            if (shifted.size() == 1 && shifted != name)
+                table[static_cast<uint8_t>(shifted[0]) & 0x7F] = static_cast<uint16_t>(vk | 0x100);
+            if (name.size() == 1)
+                table[static_cast<uint8_t>(name[0]) & 0x7F] = static_cast<uint16_t>(vk);
+        }
+        for (int c = 'A'; c <= 'Z'; ++c)
+        {
+            table[c] = static_cast<uint16_t>(c | 0x100);
+            table[c - 'A' + 'a'] = static_cast<uint16_t>(c);
+        }
+        table[' '] = 0x20;
+        return table;
+    }
+
+    constexpr std::array<uint16_t, 128> AsciiKeys = MakeAsciiKeys();
+
+    static_assert(AsciiKeys['a'] == 'A' && AsciiKeys['!'] == ('1' | 0x100) && AsciiKeys['?'] == (0xBF | 0x100),
+        "TerminalKeyboard: ascii table");
+
+    const int VkBack = 0x08, VkTab = 0x09, VkClear = 0x0C, VkReturn = 0x0D, VkEscape = 0x1B, VkSpace = 0x20;
+    const int VkPrior = 0x21, VkNext = 0x22, VkEnd = 0x23, VkHome = 0x24;
+    const int VkLeft = 0x25, VkUp = 0x26, VkRight = 0x27, VkDown = 0x28;
+    const int VkInsert = 0x2D, VkDelete = 0x2E, VkF1 = 0x70;
+
+    // CSI/SS3 son karakteri (A, B, ..., P-S)
+    int VkFromFinal(uint8_t final)
+    {
+        switch (final)
+        {
+        case 'A': return VkUp;
+        case 'B': return VkDown;
+        case 'C': return VkRight;
+        case 'D': return VkLeft;
+        case 'E': return VkClear;
+        case 'H': return VkHome;
+        case 'F': return VkEnd;
+        case 'M': return VkReturn;      // SS3 M: keypad Enter
+        case 'P': return VkF1;
+        case 'Q': return VkF1 + 1;
+        case 'R': return VkF1 + 2;
+        case 'S': return VkF1 + 3;
+        }
+        return 0;
+    }
+
+    // CSI <n> ~
+    int VkFromTilde(int n)
+    {
+        switch (n)
+        {
+        case 1: case 7: return VkHome;
+        case 2: return VkInsert;
+        case 3: return VkDelete;
+        case 4: case 8: return VkEnd;
+        case 5: return VkPrior;
+        case 6: return VkNext;
+        }
+        if (n >= 11 && n <= 15) return VkF1 + (n - 11);        // F1-F5
+        if (n >= 17 && n <= 21) return VkF1 + 5 + (n - 17);    // F6-F10
+        if (n >= 23 && n <= 26) return VkF1 + 10 + (n - 23);   // F11-F14
+        if (n >= 28 && n <= 29) return VkF1 + 14 + (n - 28);   // F15-F16
+        if (n >= 31 && n <= 34) return VkF1 + 16 + (n - 31);   // F17-F20
+        return 0;
+    }
+}
+
+CTerminalKeyDecoder::CTerminalKeyDecoder(void)
+    : m_pendingSize(0), m_unknownSequences(0)
+{
+}
+
+void CTerminalKeyDecoder::Reset(void)
+{
+    m_pendingSize = 0;
+}
+
+bool CTerminalKeyDecoder::HasPending(void) const
+{
+    return m_pendingSize > 0;
+}
+
+uint64_t CTerminalKeyDecoder::GetUnknownSequenceCount(void) const
+{
+    return m_unknownSequences;
+}
+
+void CTerminalKeyDecoder::Feed(const uint8_t* data, size_t size, std::vector<TerminalKey>& out)
+{
+    const size_t ChunkSize = 256;
+    uint8_t buf[MaxSequence + ChunkSize];
+
+    while (size > 0)
+    {
+        const size_t chunk = size < ChunkSize ? size : ChunkSize;
+        memcpy(buf, m_pending, m_pendingSize);
+        memcpy(buf + m_pendingSize, data, chunk);
+        const size_t total = m_pendingSize + chunk;
+        data += chunk;
+        size -= chunk;
+
+        size_t pos = 0;
+        while (pos < total)
+        {
+            const size_t used = DecodeOne(buf, total, pos, out, false);
+            if (used == 0)
+                break;
+            pos += used;
+        }
+
+        m_pendingSize = total - pos;
+        memcpy(m_pending, buf + pos, m_pendingSize);
+    }
+}
+
+void CTerminalKeyDecoder::FlushPending(std::vector<TerminalKey>& out)
+{
+    size_t pos = 0;
+    while (pos < m_pendingSize)
+        pos += DecodeOne(m_pending, m_pendingSize, pos, out, true);
+    m_pendingSize = 0;
+}
+
+size_t CTerminalKeyDecoder::DecodeOne(const uint8_t* buf, size_t size, size_t pos, std::vector<TerminalKey>& out, bool final)
+{
+    if (buf[pos] == VkEscape)
+        return DecodeEscape(buf, size, pos, out, final);
+
+    TerminalKey key;
+    if (DecodeByte(buf[pos], key))
+        out.push_back(key);
+    return 1;
+}
+
+size_t CTerminalKeyDecoder::DecodeEscape(const uint8_t* buf, size_t size, size_t pos, std::vector<TerminalKey>& out, bool final)
+{
+    TerminalKey key;
+
+    if (pos + 1 >= size)
+    {
+        if (!final)
+            return 0;
+        key.vk = VkEscape;
+        out.push_back(key);
+        return 1;
+    }
+
+    const uint8_t next = buf[pos + 1];
+
+    if (next == '[')
+    {
+        size_t j = pos + 2;
+
+        // Linux konsolu: ESC [ [ A..E = F1..F5
+        if (j < size && buf[j] == '[')
+        {
+            if (j + 1 >= size)
+            {
+                if (!final)
+                    return 0;
+                m_unknownSequences++;
+                return size - pos;
+            }
+            if (buf[j + 1] >= 'A' && buf[j + 1] <= 'E')
+            {
+                key.vk = VkF1 + (buf[j + 1] - 'A');
+                out.push_back(key);
+            }
+            else
+                m_unknownSequences++;
+            return 4;
+        }
+
+        int params[4] = { 0, 0, 0, 0 };
+        int paramCount = 0;
+        while (j < size && ((buf[j] >= '0' && buf[j] <= '9') || buf[j] == ';'))
+        {
+            if (buf[j] == ';')
+            {
+                if (paramCount < 3)
+                    paramCount++;
+            }
+            else if (params[paramCount] < MaxParamValue)
+                params[paramCount] = params[paramCount] * 10 + (buf[j] - '0');
+            ++j;
+        }
+
+        if (j >= size)
+        {
+            if (!final && j - pos < MaxSequence)
+                return 0;
+            if (j == pos + 2)
+            {
+                // tek basina "ESC [" : Alt+[
+                DecodeByte('[', key);
+                key.alt = true;
+                out.push_back(key);
+                return 2;
+            }
+            m_unknownSequences++;
+            return j - pos;
+        }
+
+        const uint8_t finalByte = buf[j];
+        if (finalByte == '~')
+        {
+            key.vk = VkFromTilde(params[0]);
+            ApplyModifier(params[1], key);
+        }
+        else if (finalByte == 'Z')
+        {
+            key.vk = VkTab;
+            key.shift = true;
+        }
+        else
+        {
+            // ESC [ 1 ; 5 C gibi: degistirici ikinci parametrede
+            key.vk = VkFromFinal(finalByte);
+            ApplyModifier(paramCount > 0 ? params[1] : 0, key);
+        }
+
+        if (key.vk != 0)
+            out.push_back(key);
+        else
+            m_unknownSequences++;
+        return j - pos + 1;
+    }
+
+    if (next == 'O')
+    {
+        if (pos + 2 >= size)
+        {
+            if (!final)
+                return 0;
+            DecodeByte('O', key);
+            key.alt = true;
+            out.push_back(key);
+            return 2;
+        }
+
+        key.vk = VkFromFinal(buf[pos + 2]);
+        if (key.vk != 0)
+            out.push_back(key);
+        else
+            m_unknownSequences++;
+        return 3;
+    }
+
+    if (next == VkEscape)
+    {
+        key.vk = VkEscape;
+        out.push_back(key);
+        return 1;
+    }
+
+    // ESC + karakter: Alt (meta) ile basilmis tus
+    if (DecodeByte(next, key))
+    {
+        key.alt = true;
+        out.push_back(key);
+    }
+    return 2;
+}
+
+bool CTerminalKeyDecoder::DecodeByte(uint8_t b, TerminalKey& key)
+{
+    key = TerminalKey();
+
+    switch (b)
+    {
+    case 0x0D: case 0x0A: key.vk = VkReturn; return true;
+    case 0x09: key.vk = VkTab; return true;
+    case 0x7F: case 0x08: key.vk = VkBack; return true;
+    case 0x00: key.vk = VkSpace; key.ctrl = true; return true;
+    case 0x1C: key.vk = 0xDC; key.ctrl = true; return true;     // Ctrl+Backslash
+    case 0x1D: key.vk = 0xDD; key.ctrl = true; return true;     // Ctrl+]
+    }
+
+    if (b >= 0x01 && b <= 0x1A)
+    {
+        key.vk = 'A' + (b - 1);
+        key.ctrl = true;
+        return true;
+    }
+
+    if (b >= 0x20 && b < 0x7F && AsciiKeys[b] != 0)
+    {
+        key.vk = AsciiKeys[b] & 0xFF;
+        key.shift = (AsciiKeys[b] & 0x100) != 0;
+        return true;
+    }
+
+    return false;   // UTF-8 devam baytlari vb.
+}
+
+// xterm degistirici parametresi: 1 + (shift | alt << 1 | ctrl << 2 | meta << 3)
+void CTerminalKeyDecoder::ApplyModifier(int param, TerminalKey& key)
+{
+    if (param < 2)
+        return;
+    const int bits = param - 1;
+    key.shift = (bits & 1) != 0;
+    key.alt   = (bits & (2 | 8)) != 0;
+    key.ctrl  = (bits & 4) != 0;
+}
+
+#ifndef _WIN32
+
+#include "AllocationTracker.h"
+#include "ConsoleLogger.h"
+#include "LoopPacer.h"
+#include "TraceRecorder.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstdio>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+
+namespace
+{
+    // "[Tag] Name (vk)" veya holdCount > 0 ise "... [Held Nx<rate>]"; yigin tamponu, heap kullanilmaz
+    void LogKey(ILogger& logger, const char* tag, int vk, bool shift, int holdCount, const char* rate = "")
+    {
+        const std::string_view name = KeyNames::KeyName(vk, shift);
+        char line[160];
+        const int length = holdCount > 0
+            ? snprintf(line, sizeof(line), "%s %.*s (%d) [Held %dx%s]", tag, static_cast<int>(name.size()), name.data(), vk, holdCount, rate)
+            : snprintf(line, sizeof(line), "%s %.*s (%d)%s", tag, static_cast<int>(name.size()), name.data(), vk, rate);
+        if (length > 0)
+            logger.Log(std::string_view(line, std::min<size_t>(static_cast<size_t>(length), sizeof(line) - 1)));
+    }
+}
+
+CTerminalKeyboardListener::CTerminalKeyboardListener(void)
+    : m_running(false), m_initialized(false), m_deviceId(InputEvent::KeyboardDeviceId), m_logLevels(LogLevel::Trace),
+      m_metrics("CTerminalKeyboardListener"), m_fd(-1), m_ownsFd(false), m_rawMode(false), m_unknownSequences(0),
+      m_heldVk(0), m_heldCode(0), m_holdCount(0), m_lastInputNs(0), m_escapeDeadlineNs(0)
+{
+    m_wakePipe[0] = m_wakePipe[1] = -1;
+    memset(&m_savedMode, 0, sizeof(m_savedMode));
+    m_keys.reserve(64);
+    m_events.reserve(128);
+    m_logger = std::make_shared<ConsoleLogger>();
+}
+
+CTerminalKeyboardListener::~CTerminalKeyboardListener(void)
+{
+    Stop();
+    CloseFd();
+    for (int& fd : m_wakePipe)
+    {
+        if (fd >= 0)
+            close(fd);
+        fd = -1;
+    }
+}
+
+void CTerminalKeyboardListener::SetFd(int fd)
+{
+    CloseFd();
+    m_fd = fd;
+    m_ownsFd = false;
+}
+
+void CTerminalKeyboardListener::SetConfig(const TerminalKeyboardConfig& config)
+{
+    m_config = config;
+}
+
+bool CTerminalKeyboardListener::Init(void)
+{
+    if (m_fd < 0)
+    {
+        if (isatty(STDIN_FILENO))
+        {
+            m_fd = STDIN_FILENO;
+            m_ownsFd = false;
+        }
+        else
+        {
+            m_fd = open("/dev/tty", O_RDWR | O_NOCTTY | O_CLOEXEC);
+            m_ownsFd = m_fd >= 0;
+        }
+    }
+
+    if (m_fd < 0)
+    {
+        JL_LOG_ERROR(m_logLevels, LogCategory::Lifecycle, m_logger->Log("[CTerminalKeyboardListener] No terminal available."));
+        return false;
+    }
+
+    if (m_wakePipe[0] < 0 && pipe2(m_wakePipe, O_CLOEXEC | O_NONBLOCK) != 0)
+    {
+        JL_LOG_ERROR(m_logLevels, LogCategory::Lifecycle,
+            m_logger->Log("[CTerminalKeyboardListener] pipe2 failed: " + std::string(strerror(errno))));
+        return false;
+    }
+
+    m_initialized = true;
+    JL_LOG_INFO(m_logLevels, LogCategory::Lifecycle, m_logger->Log("[CTerminalKeyboardListener] Init completed."));
+    return true;
+}
+
+void CTerminalKeyboardListener::Start(void)
+{
+    if (m_initialized && !m_running)
+    {
+        if (!EnterRawMode())
+        {
+            JL_LOG_ERROR(m_logLevels, LogCategory::Lifecycle,
+                m_logger->Log("[CTerminalKeyboardListener] Raw mode failed: " + std::string(strerror(errno))));
+            return;
+        }
+
+        m_running = true;
+        m_thread = std::thread(&CTerminalKeyboardListener::ListenLoop, this);
+        JL_LOG_INFO(m_logLevels, LogCategory::Lifecycle, m_logger->Log("[CTerminalKeyboardListener] Listening thread started."));
+    }
+}
+
+void CTerminalKeyboardListener::Stop(void)
+{
+    bool wasRunning = m_running.exchange(false);
+    if (m_wakePipe[1] >= 0)
+    {
+        const char wake = 1;
+        (void)!write(m_wakePipe[1], &wake, 1);
+    }
+    if (m_thread.joinable() && std::this_thread::get_id() != m_thread.get_id())
+    {
+        m_thread.join();
+    }
+    RestoreMode();
+    if (wasRunning)
+    {
+        JL_LOG_INFO(m_logLevels, LogCategory::Lifecycle, m_logger->Log("[CTerminalKeyboardListener] Listening thread stopped."));
+    }
+}
+
+void CTerminalKeyboardListener::SetLogger(std::shared_ptr<ILogger> logger)
+{
+    if (logger) m_logger = logger;
+}
+
+void CTerminalKeyboardListener::RegisterHandler(int vk, std::function<void(const KeyEvent&)> handler)
+{
+    m_handlers[vk].push_back(handler);
+}
+
+void CTerminalKeyboardListener::SetBatchHandler(InputBatchHandler handler)
+{
+    m_batchHandler = handler;
+}
+
+void CTerminalKeyboardListener::SetDeviceId(uint8_t deviceId)
+{
+    m_deviceId = deviceId;
+}
+
+bool CTerminalKeyboardListener::IsRunning(void) const { return m_running.load(); }
+bool CTerminalKeyboardListener::IsInit(void) const { return m_initialized.load(); }
+
+void CTerminalKeyboardListener::SetSilentMode(bool silentMode)
+{
+    m_logLevels.SetAll(silentMode ? LogLevel::Off : LogLevel::Trace);
+}
+
+void CTerminalKeyboardListener::SetLogLevel(LogCategory category, LogLevel level)
+{
+    m_logLevels.SetLevel(category, level);
+}
+
+void CTerminalKeyboardListener::SetLogRateInterval(std::chrono::milliseconds interval)
+{
+    m_logRate.SetInterval(std::chrono::duration_cast<std::chrono::nanoseconds>(interval).count());
+}
+
+const CLogRateLimiter& CTerminalKeyboardListener::GetLogRateLimiter(void) const
+{
+    return m_logRate;
+}
+
+uint64_t CTerminalKeyboardListener::GetUnknownSequenceCount(void) const
+{
+    return m_unknownSequences.load(std::memory_order_relaxed);
+}
+
+ListenerMetricsSnapshot CTerminalKeyboardListener::GetMetricsSnapshot(void) const
+{
+    return m_metrics.Snapshot();
+}
+
+bool CTerminalKeyboardListener::EnterRawMode(void)
+{
+    // Pipe/dosya ise oldugu gibi okunur
+    if (m_rawMode || !isatty(m_fd))
+        return true;
+
+    if (tcgetattr(m_fd, &m_savedMode) != 0)
+        return false;
+
+    struct termios raw = m_savedMode;
+    raw.c_iflag &= ~(IGNBRK | BRKINT | PARMRK | ISTRIP | INLCR | IGNCR | ICRNL | IXON);
+    raw.c_lflag &= ~(ECHO | ECHONL | ICANON | ISIG | IEXTEN);
+    raw.c_cflag &= ~(CSIZE | PARENB);
+    raw.c_cflag |= CS8;
+    // OPOST acik kalir; log satirlarindaki \n yine satir basina doner
+    raw.c_cc[VMIN] = 1;
+    raw.c_cc[VTIME] = 0;
+
+    if (tcsetattr(m_fd, TCSANOW, &raw) != 0)
+        return false;
+
+    m_rawMode = true;
+    return true;
+}
+
+void CTerminalKeyboardListener::RestoreMode(void)
+{
+    if (m_rawMode)
+    {
+        tcsetattr(m_fd, TCSANOW, &m_savedMode);
+        m_rawMode = false;
+    }
+}
+
+void CTerminalKeyboardListener::CloseFd(void)
+{
+    if (m_ownsFd && m_fd >= 0)
+        close(m_fd);
+    m_fd = -1;
+    m_ownsFd = false;
+}
+
+void CTerminalKeyboardListener::ListenLoop(void)
+{
+    JL_LOG_INFO(m_logLevels, LogCategory::Lifecycle, m_logger->Log("[CTerminalKeyboardListener] Dinleme baslatildi. ESC ile cikabilirsiniz."));
+    JL_TRACE_THREAD("CTerminalKeyboardListener");
+    JL_ALLOC_THREAD("CTerminalKeyboardListener");
+
+    const int64_t releaseNs = std::chrono::duration_cast<std::chrono::nanoseconds>(m_config.releaseTimeout).count();
+    const int64_t escapeNs = std::chrono::duration_cast<std::chrono::nanoseconds>(m_config.escapeTimeout).count();
+
+    m_decoder.Reset();
+    m_heldVk = 0;
+
+    struct pollfd fds[2];
+    fds[0].fd = m_fd;
+    fds[0].events = POLLIN;
+    fds[1].fd = m_wakePipe[0];
+    fds[1].events = POLLIN;
+
+    uint8_t buf[256];
+
+    while (m_running)
+    {
+        // Bekleme suresi sadece bekleyen bir is varsa sinirlidir: tus birakma veya yarim kacis dizisi
+        int64_t deadlineNs = INT64_MAX;
+        if (m_heldVk != 0)
+            deadlineNs = m_lastInputNs + releaseNs;
+        if (m_decoder.HasPending() && m_escapeDeadlineNs < deadlineNs)
+            deadlineNs = m_escapeDeadlineNs;
+
+        int timeoutMs = -1;
+        if (deadlineNs != INT64_MAX)
+        {
+            const int64_t waitNs = deadlineNs - CLoopPacer::NowNs();
+            timeoutMs = waitNs <= 0 ? 0 : static_cast<int>((waitNs + 999999) / 1000000);
+        }
+
+        fds[0].revents = 0;
+        fds[1].revents = 0;
+        const int rc = poll(fds, 2, timeoutMs);
+        if (rc < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            JL_LOG_ERROR(m_logLevels, LogCategory::Lifecycle,
+                m_logger->Log("[CTerminalKeyboardListener] poll failed: " + std::string(strerror(errno))));
+            break;
+        }
+
+        JL_TRACE_SPAN_BEGIN(readSpan, "Read");
+        JL_METRICS_TICKS(pollBegin);
+        const int64_t nowNs = CLoopPacer::NowNs();
+        m_keys.clear();
+        m_events.clear();
+
+        if (fds[1].revents & POLLIN)
+        {
+            char drain[16];
+            while (read(m_wakePipe[0], drain, sizeof(drain)) > 0)
+            {
+            }
+        }
+
+        if (fds[0].revents & POLLIN)
+        {
+            const ssize_t n = read(m_fd, buf, sizeof(buf));
+            if (n > 0)
+            {
+                m_decoder.Feed(buf, static_cast<size_t>(n), m_keys);
+                if (m_decoder.HasPending())
+                    m_escapeDeadlineNs = nowNs + escapeNs;
+            }
+            else if (n == 0 || (errno != EAGAIN && errno != EINTR))
+            {
+                // Terminal kapandi (pty master kapatildi, SSH koptu)
+                m_running = false;
+            }
+        }
+        else if (fds[0].revents & (POLLHUP | POLLERR | POLLNVAL))
+        {
+            m_running = false;
+        }
+
+        if (m_decoder.HasPending() && nowNs >= m_escapeDeadlineNs)
+            m_decoder.FlushPending(m_keys);
+
+        for (const TerminalKey& key : m_keys)
+            OnKey(key, nowNs);
+
+        if (m_heldVk != 0 && (nowNs - m_lastInputNs >= releaseNs || !m_running))
+            ReleaseKey(nowNs);
+
+        m_unknownSequences.store(m_decoder.GetUnknownSequenceCount(), std::memory_order_relaxed);
+
+        const bool anyEvent = !m_events.empty();
+        DispatchEvents();
+        JL_METRICS_CALL(m_metrics.OnPoll(ListenerMetricsClock::Ticks() - pollBegin, anyEvent));
+        JL_TRACE_SPAN_END(readSpan);
+    }
+
+    if (m_heldVk != 0)
+    {
+        m_events.clear();
+        ReleaseKey(CLoopPacer::NowNs());
+        DispatchEvents();
+    }
+
+    JL_LOG_INFO(m_logLevels, LogCategory::Lifecycle, m_logger->Log("[CTerminalKeyboardListener] Dinleme durduruldu."));
+}
+
+// Ayni tusun tekrari Hold, farkli tus once eskisini birakir sonra Down uretir.
+void CTerminalKeyboardListener::OnKey(const TerminalKey& key, int64_t timestampNs)
+{
+    const uint16_t code = static_cast<uint16_t>(key.vk |
+        (key.shift ? InputEvent::ModShift : 0) | (key.ctrl ? InputEvent::ModCtrl : 0) | (key.alt ? InputEvent::ModAlt : 0));
+
+    m_lastInputNs = timestampNs;
+
+    if (key.vk == m_heldVk)
+    {
+        m_heldCode = code;
+        m_holdCount++;
+
+        // Ilk Hold satiri yazilir, sonrasi aralik basina bir ozet (CKeyboardListener ile ayni)
+        JL_LOG_TRACE(m_logLevels, LogCategory::KeyHold,
+            LogRateSummary rate;
+            char rateText[64];
+            if (m_logRate.Check(LogCategory::KeyHold, static_cast<uint16_t>(key.vk), timestampNs, rate))
+                LogKey(*m_logger, "[Hold]", key.vk, key.shift, m_holdCount, rate.Format(rateText, sizeof(rateText))));
+        JL_METRICS_CALL(m_metrics.AddEvent(ListenerEventKind::KeyHold));
+        m_events.push_back(InputEvent::Make(timestampNs, m_deviceId, InputEventKind::KeyHold, code, static_cast<float>(m_holdCount)));
+        return;
+    }
+
+    if (m_heldVk != 0)
+        ReleaseKey(timestampNs);
+
+    m_heldVk = key.vk;
+    m_heldCode = code;
+    m_holdCount = 1;
+
+    JL_LOG_INFO(m_logLevels, LogCategory::Key,
+        LogKey(*m_logger, "[Down]", key.vk, key.shift, 0));
+    JL_METRICS_CALL(m_metrics.AddEvent(ListenerEventKind::KeyDown));
+    m_events.push_back(InputEvent::Make(timestampNs, m_deviceId, InputEventKind::KeyDown, code, 1.0f));
+
+    if (key.vk == VkEscape && m_config.stopOnEscape)
+    {
+        JL_LOG_INFO(m_logLevels, LogCategory::Lifecycle, m_logger->Log("[CTerminalKeyboardListener] ESC algilandi, cikiliyor."));
+        m_running = false;
+    }
+}
+
+void CTerminalKeyboardListener::ReleaseKey(int64_t timestampNs)
+{
+    JL_LOG_TRACE(m_logLevels, LogCategory::KeyHold,
+        LogRateSummary rate;
+        char rateText[64];
+        if (m_logRate.End(LogCategory::KeyHold, static_cast<uint16_t>(m_heldVk), timestampNs, rate))
+        {
+            char released[80];
+            snprintf(released, sizeof(released), " released%s", rate.Format(rateText, sizeof(rateText)));
+            LogKey(*m_logger, "[Hold]", m_heldVk, (m_heldCode & InputEvent::ModShift) != 0, 0, released);
+        });
+    JL_LOG_INFO(m_logLevels, LogCategory::Key,
+        LogKey(*m_logger, "[Up  ]", m_heldVk, (m_heldCode & InputEvent::ModShift) != 0, 0));
+    JL_METRICS_CALL(m_metrics.AddEvent(ListenerEventKind::KeyUp));
+    m_events.push_back(InputEvent::Make(timestampNs, m_deviceId, InputEventKind::KeyUp, m_heldCode, 0.0f));
+    m_heldVk = 0;
+    m_holdCount = 0;
+}
+
+void CTerminalKeyboardListener::DispatchEvents(void)
+{
+    if (m_events.empty())
+        return;
+
+    if (m_batchHandler)
+    {
+        JL_TRACE_SCOPE("BatchHandler");
+        JL_METRICS_TIME_HANDLER(m_metrics, m_batchHandler(std::span<const InputEvent>(m_events.data(), m_events.size())));
+    }
+
+    for (const InputEvent& e : m_events)
+    {
+        auto it = m_handlers.find(e.KeyCode());
+        if (it == m_handlers.end())
+            continue;
+
+        KeyState state = e.kind == InputEventKind::KeyDown ? KeyState::Down :
+                         e.kind == InputEventKind::KeyHold ? KeyState::Hold : KeyState::Up;
+        KeyEvent evt{ e.KeyCode(), state,
+            e.HasModifier(InputEvent::ModShift), e.HasModifier(InputEvent::ModCtrl), e.HasModifier(InputEvent::ModAlt) };
+
+        for (auto& handler : it->second)
+        {
+            JL_TRACE_SCOPE("KeyHandler");
+            JL_METRICS_TIME_HANDLER(m_metrics, handler(evt));
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Terminalden gelen bayt akisini tus olaylarina cevirir: yazdirilabilir karakterler,
+// Ctrl+harf, Alt (ESC onekli) ve CSI/SS3 kacis dizileri (ok, F1-F20, Home/End, ...,
+// xterm degistirici parametreleri). Platformdan bagimsizdir.
+struct TerminalKey
+{
+    int  vk = 0;
+    bool shift = false;
+    bool ctrl = false;
+    bool alt = false;
+};
+
+class CTerminalKeyDecoder
+{
+public:
+    static const size_t MaxSequence = 16;
+    static const int MaxParamValue = 9999;      // CSI parametresi bunu gecince buyumez; uzun rakam dizisi tasmaz
+
+    CTerminalKeyDecoder(void);
+
+    // Tamamlanan tuslar out'a eklenir; yarim kalan kacis dizisi sonraki Feed'e saklanir.
+    void Feed(const uint8_t* data, size_t size, std::vector<TerminalKey>& out);
+
+    // Yarim dizi bekleniyor mu (tek basina ESC veya eksik CSI)
+    bool HasPending(void) const;
+
+    // Kacis zaman asimi doldu: bekleyen ESC, Escape tusu (veya Alt+tus) olarak verilir.
+    void FlushPending(std::vector<TerminalKey>& out);
+
+    void Reset(void);
+
+    uint64_t GetUnknownSequenceCount(void) const;
+
+private:
+    // buf[pos]'tan itibaren bir tus cozer; tuketilen bayt sayisi, eksikse 0
+    size_t DecodeOne(const uint8_t* buf, size_t size, size_t pos, std::vector<TerminalKey>& out, bool final);
+    size_t DecodeEscape(const uint8_t* buf, size_t size, size_t pos, std::vector<TerminalKey>& out, bool final);
+    static bool DecodeByte(uint8_t b, TerminalKey& key);
+    static void ApplyModifier(int param, TerminalKey& key);
+
+    uint8_t  m_pending[MaxSequence];
+    size_t   m_pendingSize;
+    uint64_t m_unknownSequences;
+};
+
+#ifndef _WIN32
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <span>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <termios.h>
+
+#include "ILogger.h"
+#include "LogLevel.h"
+#include "LogRateLimiter.h"
+#include "KeyEvent.h"
+#include "InputEvent.h"
+#include "ListenerMetrics.h"
+
+struct TerminalKeyboardConfig
+{
+    // Terminal birakma bildirmez: son bayttan bu kadar sonra Up uretilir.
+    // Otomatik tekrarin ilk gecikmesinden (tipik 250-500 ms) uzun olmalidir.
+    std::chrono::milliseconds releaseTimeout = std::chrono::milliseconds(550);
+    std::chrono::milliseconds escapeTimeout = std::chrono::milliseconds(25);
+    bool stopOnEscape = true;
+};
+
+// Headless Linux / SSH icin klavye: tty raw moda alinir, fd poll() ile beklenir
+// (olay yoksa thread uyur), baytlar CTerminalKeyDecoder ile cozulur ve
+// CKeyboardListener ile ayni Down/Hold/Up olaylari ve handler arayuzu sunulur.
+// Terminal sadece son tusu tekrarladigi icin yeni bir tus oncekini birakir (Up).
+// Raw modda Ctrl+C sinyal degil tus olayidir; cikis ESC iledir.
+// fd disaridan verilebilir (orn. pseudo-terminal slave ucu ile test).
+class CTerminalKeyboardListener
+{
+public:
+    CTerminalKeyboardListener(void);
+    ~CTerminalKeyboardListener(void);
+
+    // Init'ten once; verilmezse stdin tty ise o, degilse /dev/tty acilir. fd kapatilmaz.
+    void SetFd(int fd);
+    void SetConfig(const TerminalKeyboardConfig& config);
+
+    bool Init(void);
+    void Start(void);
+    void Stop(void);
+    void SetLogger(std::shared_ptr<ILogger> logger);
+    void RegisterHandler(int vk, std::function<void(const KeyEvent&)> handler);
+    void SetBatchHandler(InputBatchHandler handler);
+    void SetDeviceId(uint8_t deviceId);
+
+    bool IsRunning(void) const;
+    bool IsInit(void) const;
+    void SetSilentMode(bool silentMode);
+    void SetLogLevel(LogCategory category, LogLevel level);
+    void SetLogRateInterval(std::chrono::milliseconds interval);
+    const CLogRateLimiter& GetLogRateLimiter(void) const;
+
+    uint64_t GetUnknownSequenceCount(void) const;
+    ListenerMetricsSnapshot GetMetricsSnapshot(void) const;
+
+private:
+    void ListenLoop(void);
+    void OnKey(const TerminalKey& key, int64_t timestampNs);
+    void ReleaseKey(int64_t timestampNs);
+    void DispatchEvents(void);
+    bool EnterRawMode(void);
+    void RestoreMode(void);
+    void CloseFd(void);
+
+    TerminalKeyboardConfig m_config;
+    std::thread m_thread;
+    std::atomic<bool> m_running;
+    std::atomic<bool> m_initialized;
+    std::shared_ptr<ILogger> m_logger;
+    std::unordered_map<int, std::vector<std::function<void(const KeyEvent&)>>> m_handlers;
+    InputBatchHandler m_batchHandler;
+    uint8_t m_deviceId;
+    CLogLevels m_logLevels;
+    CLogRateLimiter m_logRate;
+    CListenerMetrics m_metrics;
+
+    int m_fd;
+    bool m_ownsFd;
+    int m_wakePipe[2];
+    struct termios m_savedMode;
+    bool m_rawMode;
+
+    // Listener thread'ine ait
+    CTerminalKeyDecoder m_decoder;
+    std::atomic<uint64_t> m_unknownSequences;
+    int m_heldVk;
+    uint16_t m_heldCode;
+    uint32_t m_holdCount;
+    int64_t m_lastInputNs;
+    int64_t m_escapeDeadlineNs;
+    std::vector<TerminalKey> m_keys;
+    std::vector<InputEvent> m_events;
+};
+
+#endif
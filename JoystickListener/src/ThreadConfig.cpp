@@ -0,0 +1,277 @@
+#include "ThreadConfig.h"
+
+#include <sstream>
+#include <cstring>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <cerrno>
+#endif
+
+const char* ThreadSchedPolicyName(ThreadSchedPolicy policy)
+{
+    switch (policy)
+    {
+        case ThreadSchedPolicy::Fifo:       return "FIFO";
+        case ThreadSchedPolicy::RoundRobin: return "RR";
+        default:                            return "Default";
+    }
+}
+
+#ifdef _WIN32
+
+static std::string WideToUtf8(const wchar_t* text)
+{
+    int len = WideCharToMultiByte(CP_UTF8, 0, text, -1, NULL, 0, NULL, NULL);
+    if (len <= 1)
+        return std::string();
+    std::string out(static_cast<size_t>(len - 1), '\0');
+    WideCharToMultiByte(CP_UTF8, 0, text, -1, &out[0], len, NULL, NULL);
+    return out;
+}
+
+static std::wstring Utf8ToWide(const std::string& text)
+{
+    int len = MultiByteToWideChar(CP_UTF8, 0, text.c_str(), -1, NULL, 0);
+    if (len <= 1)
+        return std::wstring();
+    std::wstring out(static_cast<size_t>(len - 1), L'\0');
+    MultiByteToWideChar(CP_UTF8, 0, text.c_str(), -1, &out[0], len);
+    return out;
+}
+
+// SetThreadDescription Windows 10 1607 ile geldi; eski sistemlerde de calismak icin dinamik yukle.
+typedef HRESULT (WINAPI *SetThreadDescriptionFn)(HANDLE, PCWSTR);
+typedef HRESULT (WINAPI *GetThreadDescriptionFn)(HANDLE, PWSTR*);
+
+static int ToWindowsPriority(ThreadSchedPolicy policy, int priority)
+{
+    if (policy == ThreadSchedPolicy::Default)
+        return THREAD_PRIORITY_NORMAL;
+    if (priority >= 50)
+        return THREAD_PRIORITY_TIME_CRITICAL;
+    return THREAD_PRIORITY_HIGHEST;
+}
+
+ThreadConfigResult ApplyThreadConfig(std::thread::native_handle_type nativeHandle, const ThreadConfig& config)
+{
+    ThreadConfigResult result;
+    HANDLE handle = static_cast<HANDLE>(nativeHandle);
+
+    // Uygulanan maske raporlanir; istenmediyse etkin maske thread'i yeniden baglamadan okunur
+    DWORD_PTR current = 0;
+    if (!config.cpuAffinity.empty())
+    {
+        DWORD_PTR mask = 0;
+        for (int cpu : config.cpuAffinity)
+        {
+            if (cpu >= 0 && cpu < static_cast<int>(sizeof(DWORD_PTR) * 8))
+                mask |= (static_cast<DWORD_PTR>(1) << cpu);
+        }
+        if (mask == 0 || SetThreadAffinityMask(handle, mask) == 0)
+            result.warnings.push_back("SetThreadAffinityMask failed, affinity unchanged");
+        else
+            current = mask;
+    }
+
+    GROUP_AFFINITY groupAffinity;
+    ZeroMemory(&groupAffinity, sizeof(groupAffinity));
+    if (current == 0 && GetThreadGroupAffinity(handle, &groupAffinity))
+        current = static_cast<DWORD_PTR>(groupAffinity.Mask);
+
+    for (int cpu = 0; cpu < static_cast<int>(sizeof(DWORD_PTR) * 8); ++cpu)
+        if (current & (static_cast<DWORD_PTR>(1) << cpu))
+            result.cpuAffinity.push_back(cpu);
+
+    if (config.policy != ThreadSchedPolicy::Default)
+    {
+        int requested = ToWindowsPriority(config.policy, config.priority);
+        if (!SetThreadPriority(handle, requested))
+        {
+            result.warnings.push_back("SetThreadPriority failed, falling back to ABOVE_NORMAL");
+            SetThreadPriority(handle, THREAD_PRIORITY_ABOVE_NORMAL);
+        }
+    }
+
+    int effective = GetThreadPriority(handle);
+    result.priority = effective;
+    result.policy = (effective >= THREAD_PRIORITY_HIGHEST) ? config.policy : ThreadSchedPolicy::Default;
+
+    HMODULE kernel = GetModuleHandleW(L"kernel32.dll");
+    if (!config.name.empty())
+    {
+        SetThreadDescriptionFn setDescription = kernel ?
+            reinterpret_cast<SetThreadDescriptionFn>(GetProcAddress(kernel, "SetThreadDescription")) : nullptr;
+        std::wstring wide = Utf8ToWide(config.name);
+        if (!setDescription || FAILED(setDescription(handle, wide.c_str())))
+            result.warnings.push_back("SetThreadDescription unavailable, name not set");
+    }
+
+    GetThreadDescriptionFn getDescription = kernel ?
+        reinterpret_cast<GetThreadDescriptionFn>(GetProcAddress(kernel, "GetThreadDescription")) : nullptr;
+    PWSTR description = nullptr;
+    if (getDescription && SUCCEEDED(getDescription(handle, &description)) && description)
+    {
+        result.name = WideToUtf8(description);
+        LocalFree(description);
+    }
+
+    if (config.lockMemory)
+    {
+        // mlockall karsiligi yok; calisma kumesinin alt sinirini yukselterek sayfalarin
+        // disari atilmasini engelle.
+        const SIZE_T minimum = 64 * 1024 * 1024;
+        const SIZE_T maximum = 256 * 1024 * 1024;
+        if (SetProcessWorkingSetSize(GetCurrentProcess(), minimum, maximum))
+            result.memoryLocked = true;
+        else
+            result.warnings.push_back("SetProcessWorkingSetSize failed, memory not locked");
+    }
+
+    return result;
+}
+
+ThreadConfigResult ApplyThreadConfigToCurrentThread(const ThreadConfig& config)
+{
+    return ApplyThreadConfig(GetCurrentThread(), config);
+}
+
+#else
+
+static int ToPosixPolicy(ThreadSchedPolicy policy)
+{
+    switch (policy)
+    {
+        case ThreadSchedPolicy::Fifo:       return SCHED_FIFO;
+        case ThreadSchedPolicy::RoundRobin: return SCHED_RR;
+        default:                            return SCHED_OTHER;
+    }
+}
+
+static ThreadSchedPolicy FromPosixPolicy(int policy)
+{
+    if (policy == SCHED_FIFO) return ThreadSchedPolicy::Fifo;
+    if (policy == SCHED_RR)   return ThreadSchedPolicy::RoundRobin;
+    return ThreadSchedPolicy::Default;
+}
+
+ThreadConfigResult ApplyThreadConfig(std::thread::native_handle_type handle, const ThreadConfig& config)
+{
+    ThreadConfigResult result;
+
+#ifdef __linux__
+    if (!config.cpuAffinity.empty())
+    {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (int cpu : config.cpuAffinity)
+        {
+            if (cpu >= 0 && cpu < CPU_SETSIZE)
+                CPU_SET(cpu, &set);
+        }
+        int rc = pthread_setaffinity_np(handle, sizeof(set), &set);
+        if (rc != 0)
+            result.warnings.push_back(std::string("pthread_setaffinity_np failed: ") + strerror(rc));
+    }
+
+    cpu_set_t current;
+    CPU_ZERO(&current);
+    if (pthread_getaffinity_np(handle, sizeof(current), &current) == 0)
+    {
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+            if (CPU_ISSET(cpu, &current))
+                result.cpuAffinity.push_back(cpu);
+    }
+#else
+    if (!config.cpuAffinity.empty())
+        result.warnings.push_back("CPU affinity not supported on this platform");
+#endif
+
+    if (config.policy != ThreadSchedPolicy::Default)
+    {
+        int policy = ToPosixPolicy(config.policy);
+        int minPriority = sched_get_priority_min(policy);
+        int maxPriority = sched_get_priority_max(policy);
+        sched_param param;
+        std::memset(&param, 0, sizeof(param));
+        param.sched_priority = config.priority < minPriority ? minPriority :
+                               config.priority > maxPriority ? maxPriority : config.priority;
+
+        int rc = pthread_setschedparam(handle, policy, &param);
+        if (rc != 0)
+        {
+            // Yetkisiz kullanicida (EPERM) varsayilan zamanlayicida kal.
+            result.warnings.push_back(std::string("pthread_setschedparam failed: ") + strerror(rc) +
+                                      ", staying on default scheduler");
+        }
+    }
+
+    int policy = SCHED_OTHER;
+    sched_param param;
+    std::memset(&param, 0, sizeof(param));
+    if (pthread_getschedparam(handle, &policy, &param) == 0)
+    {
+        result.policy = FromPosixPolicy(policy);
+        result.priority = param.sched_priority;
+    }
+
+#ifdef __linux__
+    if (!config.name.empty())
+    {
+        // Linux thread adlari 15 karakterle sinirli.
+        std::string name = config.name.substr(0, 15);
+        int rc = pthread_setname_np(handle, name.c_str());
+        if (rc != 0)
+            result.warnings.push_back(std::string("pthread_setname_np failed: ") + strerror(rc));
+    }
+
+    char name[32] = { 0 };
+    if (pthread_getname_np(handle, name, sizeof(name)) == 0)
+        result.name = name;
+#else
+    result.name = config.name;
+#endif
+
+    if (config.lockMemory)
+    {
+        if (mlockall(MCL_CURRENT | MCL_FUTURE) == 0)
+            result.memoryLocked = true;
+        else
+            result.warnings.push_back(std::string("mlockall failed: ") + strerror(errno));
+    }
+
+    return result;
+}
+
+ThreadConfigResult ApplyThreadConfigToCurrentThread(const ThreadConfig& config)
+{
+    return ApplyThreadConfig(pthread_self(), config);
+}
+
+#endif
+
+void ThreadConfigResult::Print(std::ostream& os) const
+{
+    os << "name : " << (name.empty() ? "-" : name)
+       << "  policy : " << ThreadSchedPolicyName(policy)
+       << "  priority : " << priority
+       << "  memoryLocked : " << (memoryLocked ? "yes" : "no")
+       << "  cpus : ";
+    if (cpuAffinity.empty())
+        os << "-";
+    for (size_t i = 0; i < cpuAffinity.size(); ++i)
+        os << (i ? "," : "") << cpuAffinity[i];
+    for (const auto& warning : warnings)
+        os << "\n  warning : " << warning;
+}
+
+std::string ThreadConfigResult::ToString(void) const
+{
+    std::stringstream ss;
+    Print(ss);
+    return ss.str();
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <thread>
+#include <iostream>
+
+enum class ThreadSchedPolicy
+{
+    Default,
+    Fifo,
+    RoundRobin
+};
+
+const char* ThreadSchedPolicyName(ThreadSchedPolicy policy);
+
+struct ThreadConfig
+{
+    std::vector<int> cpuAffinity;                       // bos ise degistirilmez
+    ThreadSchedPolicy policy = ThreadSchedPolicy::Default;
+    int priority = 0;                                   // Fifo/RoundRobin icin 1..99
+    std::string name;                                   // bos ise degistirilmez
+    bool lockMemory = false;
+};
+
+// Uygulama sonrasi isletim sisteminden okunan gercek degerler.
+struct ThreadConfigResult
+{
+    std::vector<int> cpuAffinity;
+    ThreadSchedPolicy policy = ThreadSchedPolicy::Default;
+    int priority = 0;
+    std::string name;
+    bool memoryLocked = false;
+    std::vector<std::string> warnings;
+
+    void Print(std::ostream& os) const;
+    std::string ToString(void) const;
+};
+
+// Yetki yoksa (EPERM vb.) istenen ayar atlanir, uyari eklenir ve
+// mevcut ayar korunur; hicbir durumda exception atilmaz.
+ThreadConfigResult ApplyThreadConfig(std::thread::native_handle_type handle, const ThreadConfig& config);
+ThreadConfigResult ApplyThreadConfigToCurrentThread(const ThreadConfig& config);
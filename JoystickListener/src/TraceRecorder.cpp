@@ -0,0 +1,225 @@
+#include "TraceRecorder.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+// Thread cikisinda halkayi kaydediciye geri verir
+struct TraceThreadState
+{
+    CTraceRecorder::ThreadSlot* slot = nullptr;
+
+    ~TraceThreadState()
+    {
+        if (slot)
+            CTraceRecorder::Instance().ReleaseSlot(slot);
+    }
+};
+
+static thread_local TraceThreadState t_trace;
+
+static size_t RoundUpPow2(size_t v)
+{
+    size_t p = 1;
+    while (p < v)
+        p <<= 1;
+    return p;
+}
+
+CTraceBuffer::CTraceBuffer(size_t capacity, uint32_t tid, const char* threadName)
+    : m_events(RoundUpPow2(capacity ? capacity : 1)),
+    m_mask(static_cast<uint64_t>(m_events.size() - 1)),
+    m_head(0),
+    m_tid(tid),
+    m_threadName(threadName ? threadName : "")
+{
+}
+
+void CTraceBuffer::Reset(uint32_t tid, const char* threadName)
+{
+    m_head.store(0, std::memory_order_release);
+    m_tid = tid;
+    m_threadName = threadName ? threadName : "";
+}
+
+void CTraceBuffer::CopyTo(std::vector<TraceEvent>& out) const
+{
+    const uint64_t capacity = m_mask + 1;
+    const uint64_t headBefore = m_head.load(std::memory_order_acquire);
+    const uint64_t first = headBefore > capacity ? headBefore - capacity : 0;
+
+    size_t start = out.size();
+    for (uint64_t i = first; i < headBefore; ++i)
+        out.push_back(m_events[static_cast<size_t>(i & m_mask)]);
+
+    // Kopyalama sirasinda yazar ilerlediyse uzerine yazilmis olabilecek bastaki olaylari at.
+    const uint64_t headAfter = m_head.load(std::memory_order_acquire);
+    const uint64_t safeFirst = headAfter > capacity ? headAfter - capacity : 0;
+    if (safeFirst > first)
+    {
+        size_t torn = static_cast<size_t>(safeFirst - first);
+        if (torn > out.size() - start)
+            torn = out.size() - start;
+        out.erase(out.begin() + start, out.begin() + start + torn);
+    }
+}
+
+CTraceRecorder& CTraceRecorder::Instance(void)
+{
+    static CTraceRecorder instance;
+    return instance;
+}
+
+CTraceRecorder::CTraceRecorder()
+    : m_enabled(false),
+    m_dropped(0),
+    m_droppedThreads(0),
+    m_capacityPerThread(1 << 16),
+    m_maxThreads(16),
+    m_baseTicks(ListenerMetricsClock::Ticks()),
+    m_nextTid(1)
+{
+}
+
+void CTraceRecorder::SetLimits(size_t capacityPerThread, size_t maxThreads)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_capacityPerThread = capacityPerThread;
+    m_maxThreads = maxThreads;
+}
+
+void CTraceRecorder::SetEnabled(bool enabled)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (enabled)
+    {
+        // Olaylar gelmeden once; sahibi thread halkayi ilk Record'da acquire ile gorur
+        for (const auto& slot : m_threads)
+            AssignBuffer(*slot);
+    }
+    m_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool CTraceRecorder::RegisterThread(const char* threadName)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!t_trace.slot)
+    {
+        auto slot = std::make_unique<ThreadSlot>();
+        slot->name = threadName;
+        if (IsEnabled())
+            AssignBuffer(*slot);
+        t_trace.slot = slot.get();
+        m_threads.push_back(std::move(slot));
+    }
+    return !t_trace.slot->refused;
+}
+
+void CTraceRecorder::Record(const char* name, uint64_t beginTicks, uint64_t endTicks)
+{
+    CTraceBuffer* buffer = t_trace.slot ? t_trace.slot->buffer.load(std::memory_order_acquire) : nullptr;
+    if (!buffer)
+    {
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    buffer->Push(name, beginTicks, endTicks);
+}
+
+void CTraceRecorder::AssignBuffer(ThreadSlot& slot)
+{
+    if (slot.buffer.load(std::memory_order_relaxed))
+        return;
+
+    CTraceBuffer* buffer = nullptr;
+    if (!m_freeBuffers.empty())
+    {
+        buffer = m_freeBuffers.back();
+        m_freeBuffers.pop_back();
+        buffer->Reset(m_nextTid++, slot.name);
+    }
+    else if (m_buffers.size() < m_maxThreads)
+    {
+        m_buffers.emplace_back(new CTraceBuffer(m_capacityPerThread, m_nextTid++, slot.name));
+        buffer = m_buffers.back().get();
+    }
+    else
+    {
+        if (!slot.refused && m_droppedThreads.fetch_add(1, std::memory_order_relaxed) == 0)
+        {
+            std::cerr << "[Trace] thread limit (" << m_maxThreads << ") reached, "
+                      << (slot.name ? slot.name : "?") << " is not traced\n";
+        }
+        slot.refused = true;
+        return;
+    }
+
+    slot.refused = false;
+    // Sahibi thread halkayi Record'da acquire ile gorur
+    slot.buffer.store(buffer, std::memory_order_release);
+}
+
+void CTraceRecorder::ReleaseSlot(ThreadSlot* slot)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (CTraceBuffer* buffer = slot->buffer.load(std::memory_order_relaxed))
+        m_freeBuffers.push_back(buffer);
+
+    auto it = std::find_if(m_threads.begin(), m_threads.end(),
+        [slot](const std::unique_ptr<ThreadSlot>& entry) { return entry.get() == slot; });
+    if (it != m_threads.end())
+        m_threads.erase(it);
+}
+
+static void WriteJsonString(std::ostream& os, const char* text)
+{
+    os << '"';
+    for (const char* p = text ? text : ""; *p; ++p)
+    {
+        if (*p == '"' || *p == '\\')
+            os << '\\';
+        os << *p;
+    }
+    os << '"';
+}
+
+bool CTraceRecorder::WriteChromeJson(const std::string& filename) const
+{
+    std::ofstream file(filename, std::ios::trunc);
+    if (!file.is_open())
+        return false;
+
+    const double usPerTick = ListenerMetricsClock::NsPerTick() / 1000.0;
+    std::vector<TraceEvent> events;
+    bool first = true;
+
+    file << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+    file << std::fixed << std::setprecision(3);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& buffer : m_buffers)
+    {
+        if (!first)
+            file << ",\n";
+        first = false;
+        file << "{\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->GetTid()
+             << ",\"name\":\"thread_name\",\"args\":{\"name\":";
+        WriteJsonString(file, buffer->GetThreadName().c_str());
+        file << "}}";
+
+        events.clear();
+        buffer->CopyTo(events);
+        for (const TraceEvent& evt : events)
+        {
+            double ts = (static_cast<double>(static_cast<int64_t>(evt.beginTicks - m_baseTicks))) * usPerTick;
+            double dur = (static_cast<double>(evt.endTicks - evt.beginTicks)) * usPerTick;
+            file << ",\n{\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->GetTid() << ",\"name\":";
+            WriteJsonString(file, evt.name);
+            file << ",\"ts\":" << ts << ",\"dur\":" << dur << "}";
+        }
+    }
+
+    file << "\n]}\n";
+    return file.good();
+}
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+
+#include "ListenerMetrics.h"
+
+// JL_TRACE_ENABLED=0 derlemede tum trace noktalarini kaldirir.
+// Derlenmis olsa bile kayit, CTraceRecorder::SetEnabled(true) ile acilir.
+#ifndef JL_TRACE_ENABLED
+#define JL_TRACE_ENABLED 1
+#endif
+
+// name her zaman string literal olmali; sadece isaretci saklanir.
+struct TraceEvent
+{
+    const char* name;
+    uint64_t beginTicks;
+    uint64_t endTicks;
+};
+
+// Tek thread'in yazdigi sabit boyutlu halka. Dolunca en eski olaylarin uzerine yazar.
+class CTraceBuffer
+{
+public:
+    CTraceBuffer(size_t capacity, uint32_t tid, const char* threadName);
+
+    // Sahibi cikmis halkayi yeni thread'e verir; eski olaylar silinir.
+    void Reset(uint32_t tid, const char* threadName);
+
+    void Push(const char* name, uint64_t beginTicks, uint64_t endTicks)
+    {
+        uint64_t head = m_head.load(std::memory_order_relaxed);
+        TraceEvent& evt = m_events[static_cast<size_t>(head & m_mask)];
+        evt.name = name;
+        evt.beginTicks = beginTicks;
+        evt.endTicks = endTicks;
+        m_head.store(head + 1, std::memory_order_release);
+    }
+
+    // Yazarla es zamanli cagrilabilir; uzerine yazilmis olabilecek olaylar atilir.
+    void CopyTo(std::vector<TraceEvent>& out) const;
+
+    uint32_t GetTid(void) const                 { return m_tid;         }
+    const std::string& GetThreadName(void) const { return m_threadName; }
+
+private:
+    std::vector<TraceEvent> m_events;
+    uint64_t m_mask;
+    std::atomic<uint64_t> m_head;
+    uint32_t m_tid;
+    std::string m_threadName;
+};
+
+class CTraceRecorder
+{
+public:
+    static CTraceRecorder& Instance(void);
+
+    // Acilirken kayitli tum thread'lerin halkalari burada ayrilir; Record hicbir zaman ayirmaz.
+    void SetEnabled(bool enabled);
+    bool IsEnabled(void) const      { return m_enabled.load(std::memory_order_relaxed);      }
+
+    // Bellek tavani: capacityPerThread (2'nin kuvvetine yuvarlanir) x maxThreads olay.
+    // Yeni ayrilan halkalara uygulanir; varsayilan 64K olay x 16 thread.
+    void SetLimits(size_t capacityPerThread, size_t maxThreads);
+
+    // Cagiran thread'i isimlendirir. Kayit aciksa halka simdi, kapaliysa SetEnabled(true)'da
+    // ayrilir. Thread cikinca halka serbest listeye doner ve sonraki thread tarafindan yeniden
+    // kullanilir; o zamana kadar olaylari yazilabilir. Kayitli olmayan ya da halka alamayan
+    // thread'lerin olaylari sayilip atilir.
+    bool RegisterThread(const char* threadName);
+
+    void Record(const char* name, uint64_t beginTicks, uint64_t endTicks);
+
+    // Chrome trace-event JSON (Perfetto / chrome://tracing ile acilir).
+    bool WriteChromeJson(const std::string& filename) const;
+
+    uint64_t GetDroppedCount(void) const        { return m_dropped.load(std::memory_order_relaxed);        }
+    // maxThreads dolu oldugu icin halka alamayan thread sayisi
+    uint64_t GetDroppedThreadCount(void) const  { return m_droppedThreads.load(std::memory_order_relaxed);  }
+
+private:
+    friend struct TraceThreadState;
+
+    // Kayitli bir thread; halkayi SetEnabled baska bir thread'den atayabilir
+    struct ThreadSlot
+    {
+        const char* name = nullptr;
+        std::atomic<CTraceBuffer*> buffer{ nullptr };
+        bool refused = false;       // maxThreads doluydu; bir kez sayilir, sonraki acilista tekrar denenir
+    };
+
+    CTraceRecorder();
+
+    // m_mutex altinda
+    void AssignBuffer(ThreadSlot& slot);
+    void ReleaseSlot(ThreadSlot* slot);
+
+    std::atomic<bool> m_enabled;
+    std::atomic<uint64_t> m_dropped;
+    std::atomic<uint64_t> m_droppedThreads;
+    size_t m_capacityPerThread;
+    size_t m_maxThreads;
+    uint64_t m_baseTicks;
+
+    mutable std::mutex m_mutex;
+    std::vector<std::unique_ptr<CTraceBuffer>> m_buffers;
+    std::vector<CTraceBuffer*> m_freeBuffers;
+    std::vector<std::unique_ptr<ThreadSlot>> m_threads;
+    uint32_t m_nextTid;
+};
+
+class CTraceScope
+{
+public:
+    explicit CTraceScope(const char* name)
+        : m_name(name),
+        m_beginTicks(CTraceRecorder::Instance().IsEnabled() ? ListenerMetricsClock::Ticks() : 0)
+    {
+    }
+
+    ~CTraceScope()
+    {
+        End();
+    }
+
+    // Kapsam bitmeden span'i kapatir (ornegin dongu sonundaki uykudan once).
+    void End(void)
+    {
+        if (m_beginTicks != 0)
+            CTraceRecorder::Instance().Record(m_name, m_beginTicks, ListenerMetricsClock::Ticks());
+        m_beginTicks = 0;
+    }
+
+    CTraceScope(const CTraceScope&) = delete;
+    CTraceScope& operator=(const CTraceScope&) = delete;
+
+private:
+    const char* m_name;
+    uint64_t m_beginTicks;
+};
+
+#define JL_TRACE_CONCAT_INNER(a, b) a##b
+#define JL_TRACE_CONCAT(a, b) JL_TRACE_CONCAT_INNER(a, b)
+
+#if JL_TRACE_ENABLED
+#define JL_TRACE_SCOPE(name) CTraceScope JL_TRACE_CONCAT(jlTraceScope_, __LINE__)(name)
+#define JL_TRACE_SPAN_BEGIN(var, name) CTraceScope var(name)
+#define JL_TRACE_SPAN_END(var) var.End()
+#define JL_TRACE_THREAD(name) CTraceRecorder::Instance().RegisterThread(name)
+#else
+#define JL_TRACE_SCOPE(name) ((void)0)
+#define JL_TRACE_SPAN_BEGIN(var, name) ((void)0)
+#define JL_TRACE_SPAN_END(var) ((void)0)
+#define JL_TRACE_THREAD(name) ((void)0)
+#endif
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "SeqLock.h"
+
+// Tek ureticili "en son deger" kutusu.
+// Uretici WriteBuffer() icine yazar ve Publish() eder; tuketici Update()
+// ile en son yayinlanan tamponu alir ve Read() ile okur. Update/Read tek
+// tuketici thread'i icindir: Read'in dondurdugu referans sonraki Update'te
+// ureticiye geri verilebilir.
+// Snapshot() herhangi bir sayida thread'den: Publish yayinlanan degeri bir seqlock'a da
+// kopyalar, okuyucular kilit almaz, birbirini ve ureticiyi hic bekletmez; yalnizca bir
+// Publish ile cakisirsa kopyayi tekrarlar. Uretici hicbir zaman beklemez.
+template<typename T>
+class CTripleBuffer
+{
+public:
+    CTripleBuffer()
+        : m_middle(1), m_back(0), m_front(2)
+    {
+    }
+
+    // Uretici tarafi
+    T& WriteBuffer(void)
+    {
+        return m_buffers[m_back];
+    }
+
+    void Publish(void)
+    {
+        m_snapshot.Store(m_buffers[m_back]);
+        uint8_t previous = m_middle.exchange(static_cast<uint8_t>(m_back | DirtyBit), std::memory_order_acq_rel);
+        m_back = static_cast<uint8_t>(previous & IndexMask);
+    }
+
+    // Tuketici tarafi. Yeni deger geldiyse true doner.
+    bool Update(void)
+    {
+        if ((m_middle.load(std::memory_order_relaxed) & DirtyBit) == 0)
+            return false;
+
+        uint8_t previous = m_middle.exchange(m_front, std::memory_order_acq_rel);
+        m_front = static_cast<uint8_t>(previous & IndexMask);
+        return true;
+    }
+
+    const T& Read(void) const
+    {
+        return m_buffers[m_front];
+    }
+
+    // Herhangi bir thread'den; en son yayinlanan degerin yirtilmamis kopyasi
+    T Snapshot(void) const
+    {
+        T value;
+        m_snapshot.Load(value);
+        return value;
+    }
+
+private:
+    static const uint8_t DirtyBit = 0x4;
+    static const uint8_t IndexMask = 0x3;
+
+    T m_buffers[3];
+    alignas(64) std::atomic<uint8_t> m_middle;
+    alignas(64) uint8_t m_back;
+    alignas(64) uint8_t m_front;
+    CSeqLock<T> m_snapshot;
+};